@@ -0,0 +1,513 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/AI/Patrol/SFW_PatrolGraphSubsystem.h"
+
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Rooms/RoomVolume.h"
+#include "Core/Actors/SFW_DoorBase.h"
+#include "Core/Game/SFW_GameState.h"
+
+#include "Engine/TargetPoint.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "NavigationSystem.h"
+#include "NavigationData.h"
+#include "TimerManager.h"
+
+USFW_PatrolGraphSubsystem* USFW_PatrolGraphSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_PatrolGraphSubsystem>() : nullptr;
+}
+
+bool USFW_PatrolGraphSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_PatrolGraphSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Bound before the room subsystem's own begin play Rebuild, so that one is caught too
+	if (USFW_RoomSubsystem* RoomSys = Collection.InitializeDependency<USFW_RoomSubsystem>())
+	{
+		RoomsRebuiltHandle = RoomSys->OnRebuilt.AddUObject(this, &USFW_PatrolGraphSubsystem::EnsureBuilt);
+	}
+}
+
+void USFW_PatrolGraphSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+	EnsureBuilt();
+}
+
+void USFW_PatrolGraphSubsystem::Deinitialize()
+{
+	Reset();
+	if (USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this))
+	{
+		RoomSys->OnRebuilt.Remove(RoomsRebuiltHandle);
+	}
+	RoomsRebuiltHandle.Reset();
+	Super::Deinitialize();
+}
+
+void USFW_PatrolGraphSubsystem::Reset()
+{
+	if (USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this))
+	{
+		RoomSys->OnDoorChanged.Remove(DoorChangedHandle);
+	}
+	DoorChangedHandle.Reset();
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(RepathTimer);
+		World->GetTimerManager().ClearTimer(BuildTimer);
+	}
+
+	Nodes.Reset();
+	LinkStart.Reset();
+	Links.Reset();
+	DoorOpen.Reset();
+	DoorLinks.Reset();
+	RepathQueue.Reset();
+	BuildQueue.Reset();
+	NumMissingPaths = 0;
+	bBuilt = false;
+}
+
+void USFW_PatrolGraphSubsystem::EnsureBuilt()
+{
+	// Only the server's Shades patrol; clients never need the graph
+	const UWorld* World = GetWorld();
+	if (!World || World->GetNetMode() == NM_Client) return;
+
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	if (!bBuilt || (RoomSys && RoomSys->GetBuildSerial() != RoomBuildSerial))
+	{
+		Build();
+	}
+}
+
+// ---------- Build ----------
+
+void USFW_PatrolGraphSubsystem::Build()
+{
+	Reset();
+	bBuilt = true;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	RoomBuildSerial = RoomSys ? RoomSys->GetBuildSerial() : 0;
+
+	// ---------- Nodes ----------
+	for (TActorIterator<ATargetPoint> It(World); It; ++It)
+	{
+		FSFWPatrolNode& Node = Nodes.AddDefaulted_GetRef();
+		Node.Point = *It;
+		Node.Location = It->GetActorLocation();
+		Node.Room = RoomSys ? RoomSys->FindRoomIndexAt(Node.Location) : INDEX_NONE;
+	}
+
+	const int32 NumNodes = Nodes.Num();
+	if (NumNodes == 0) return;
+
+	// ---------- Door state ----------
+	if (RoomSys)
+	{
+		DoorOpen.Init(false, RoomSys->GetNumDoors());
+		for (int32 E = 0; E < RoomSys->GetNumEdges(); ++E)
+		{
+			const int32 D = RoomSys->GetEdgeDoor(E);
+			if (DoorOpen.IsValidIndex(D))
+			{
+				DoorOpen[D] = RoomSys->IsEdgeOpen(E);
+			}
+		}
+
+		DoorChangedHandle = RoomSys->OnDoorChanged.AddUObject(this, &USFW_PatrolGraphSubsystem::HandleDoorChanged);
+	}
+
+	// ---------- Links ----------
+	// Same room (any of its volumes), one door apart, or either side outside the room graph
+	auto AreRoomsLinkable = [RoomSys](int32 A, int32 B)
+	{
+		if (A == INDEX_NONE || B == INDEX_NONE || A == B) return true;
+		return RoomSys && RoomSys->GetHopDistance(A, B) <= 1;
+	};
+
+	const float MaxDistSq = FMath::Square(MaxLinkDistance);
+	TArray<TArray<int32>> Adjacent;
+	Adjacent.SetNum(NumNodes);
+
+	TArray<TPair<float, int32>> Near;
+	for (int32 A = 0; A < NumNodes; ++A)
+	{
+		Near.Reset();
+		for (int32 B = 0; B < NumNodes; ++B)
+		{
+			if (A == B || !AreRoomsLinkable(Nodes[A].Room, Nodes[B].Room)) continue;
+
+			const float DistSq = FVector::DistSquared(Nodes[A].Location, Nodes[B].Location);
+			if (DistSq <= MaxDistSq)
+			{
+				Near.Emplace(DistSq, B);
+			}
+		}
+
+		Near.Sort([](const TPair<float, int32>& L, const TPair<float, int32>& R) { return L.Key < R.Key; });
+
+		for (int32 i = 0; i < FMath::Min(Near.Num(), MaxLinksPerNode); ++i)
+		{
+			const int32 B = Near[i].Value;
+			Adjacent[A].AddUnique(B);
+			Adjacent[B].AddUnique(A);
+		}
+	}
+
+	LinkStart.SetNumUninitialized(NumNodes + 1);
+	for (int32 A = 0; A < NumNodes; ++A)
+	{
+		LinkStart[A] = Links.Num();
+		for (const int32 B : Adjacent[A])
+		{
+			FLink& Link = Links.AddDefaulted_GetRef();
+			Link.From = A;
+			Link.To = B;
+		}
+	}
+	LinkStart[NumNodes] = Links.Num();
+
+	for (int32 L = 0; L < Links.Num(); ++L)
+	{
+		const FLink& Link = Links[L];
+		for (int32 R = LinkStart[Link.To]; R < LinkStart[Link.To + 1]; ++R)
+		{
+			if (Links[R].To == Link.From)
+			{
+				Links[L].Reverse = R;
+				break;
+			}
+		}
+	}
+
+	// ---------- Paths ----------
+	// One sync navmesh query per link is too much for one frame; ProcessBuildQueue spreads them
+	for (int32 L = Links.Num() - 1; L >= 0; --L)
+	{
+		if (Links[L].Reverse > L) // filled from the other direction
+		{
+			BuildQueue.Add(L);
+		}
+	}
+
+	BuildTimer = World->GetTimerManager().SetTimerForNextTick(this, &USFW_PatrolGraphSubsystem::ProcessBuildQueue);
+}
+
+void USFW_PatrolGraphSubsystem::ProcessBuildQueue()
+{
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Paths against a navmesh still generating would come back partial or empty
+	const UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	const bool bNavBuilding = NavSys && NavSys->IsNavigationBuildInProgress();
+
+	for (int32 n = 0; !bNavBuilding && n < BuildBudgetPerTick && BuildQueue.Num() > 0; ++n)
+	{
+		const int32 L = BuildQueue.Pop(EAllowShrinking::No);
+		if (!ComputeLinkPath(L))
+		{
+			++NumMissingPaths;
+		}
+
+		FLink& Link = Links[L];
+		const int32 Door = FindLinkDoor(Link);
+		Link.Door = Door;
+		Links[Link.Reverse].Door = Door;
+		if (Door != INDEX_NONE)
+		{
+			DoorLinks.Add(Door, L);
+		}
+	}
+
+	if (BuildQueue.Num() > 0)
+	{
+		BuildTimer = World->GetTimerManager().SetTimerForNextTick(this, &USFW_PatrolGraphSubsystem::ProcessBuildQueue);
+		return;
+	}
+
+	BuildTimer.Invalidate();
+	UE_LOG(LogTemp, Log, TEXT("[PatrolGraph] %d points, %d links, %d without a path"), Nodes.Num(), Links.Num() / 2, NumMissingPaths);
+}
+
+bool USFW_PatrolGraphSubsystem::ComputeLinkPath(int32 LinkIndex)
+{
+	FLink& Link = Links[LinkIndex];
+	FLink& Back = Links[Link.Reverse];
+
+	Link.bDirty = Back.bDirty = false;
+	Link.bHasPath = Back.bHasPath = false;
+	Link.PathPoints.Reset();
+	Back.PathPoints.Reset();
+
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSys ? NavSys->GetDefaultNavDataInstance(FNavigationSystem::DontCreate) : nullptr;
+	if (!NavData) return false;
+
+	const FPathFindingQuery Query(this, *NavData, Nodes[Link.From].Location, Nodes[Link.To].Location);
+	const FPathFindingResult Result = NavSys->FindPathSync(Query);
+	if (!Result.IsSuccessful() || Result.IsPartial() || !Result.Path.IsValid()) return false;
+
+	for (const FNavPathPoint& P : Result.Path->GetPathPoints())
+	{
+		Link.PathPoints.Add(P.Location);
+	}
+	if (Link.PathPoints.Num() < 2) return false;
+
+	Back.PathPoints.Reserve(Link.PathPoints.Num());
+	for (int32 i = Link.PathPoints.Num() - 1; i >= 0; --i)
+	{
+		Back.PathPoints.Add(Link.PathPoints[i]);
+	}
+
+	Link.bHasPath = Back.bHasPath = true;
+	return true;
+}
+
+int32 USFW_PatrolGraphSubsystem::FindLinkDoor(const FLink& Link) const
+{
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	const int32 RoomA = Nodes[Link.From].Room;
+	const int32 RoomB = Nodes[Link.To].Room;
+	if (!RoomSys || RoomA == INDEX_NONE || RoomB == INDEX_NONE || RoomSys->GetHopDistance(RoomA, RoomB) == 0) return INDEX_NONE;
+
+	int32 Best = INDEX_NONE;
+	float BestDistSq = MAX_flt;
+	const TConstArrayView<int32> SideB = RoomSys->GetRoomsSharingId(RoomB);
+	for (const int32 FromRoom : RoomSys->GetRoomsSharingId(RoomA))
+	{
+		for (int32 E = RoomSys->GetEdgeBegin(FromRoom); E < RoomSys->GetEdgeEnd(FromRoom); ++E)
+		{
+			if (!SideB.Contains(RoomSys->GetEdgeTarget(E))) continue;
+
+			const int32 D = RoomSys->GetEdgeDoor(E);
+			const ASFW_DoorBase* Door = RoomSys->GetDoor(D);
+			if (!Door)
+			{
+				if (Best == INDEX_NONE) Best = D;
+				continue;
+			}
+
+			// Closest approach of the path (or the straight line) to the door
+			const FVector DoorLoc = Door->GetActorLocation();
+			float DistSq = MAX_flt;
+			if (Link.PathPoints.Num() >= 2)
+			{
+				for (int32 i = 1; i < Link.PathPoints.Num(); ++i)
+				{
+					DistSq = FMath::Min(DistSq, FMath::PointDistToSegmentSquared(DoorLoc, Link.PathPoints[i - 1], Link.PathPoints[i]));
+				}
+			}
+			else
+			{
+				DistSq = FMath::PointDistToSegmentSquared(DoorLoc, Nodes[Link.From].Location, Nodes[Link.To].Location);
+			}
+
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				Best = D;
+			}
+		}
+	}
+	return Best;
+}
+
+// ---------- Doors ----------
+
+void USFW_PatrolGraphSubsystem::HandleDoorChanged(int32 DoorIndex, bool bOpen)
+{
+	if (!DoorOpen.IsValidIndex(DoorIndex)) return;
+	DoorOpen[DoorIndex] = bOpen;
+
+	// Closing only gates the links; opening re-queries them since the navmesh may differ now
+	if (!bOpen) return;
+
+	TArray<int32, TInlineAllocator<8>> Affected;
+	DoorLinks.MultiFind(DoorIndex, Affected);
+	if (Affected.Num() == 0) return;
+
+	for (const int32 L : Affected)
+	{
+		Links[L].bDirty = true;
+		Links[Links[L].Reverse].bDirty = true;
+		RepathQueue.AddUnique(L);
+	}
+
+	UWorld* World = GetWorld();
+	if (World && !World->GetTimerManager().IsTimerActive(RepathTimer))
+	{
+		// Short delay so door nav modifiers have a chance to apply first
+		World->GetTimerManager().SetTimer(RepathTimer, this, &USFW_PatrolGraphSubsystem::ProcessRepathQueue, 0.2f, true);
+	}
+}
+
+void USFW_PatrolGraphSubsystem::ProcessRepathQueue()
+{
+	for (int32 n = 0; n < RepathBudgetPerTick && RepathQueue.Num() > 0; ++n)
+	{
+		const int32 L = RepathQueue[0];
+		RepathQueue.RemoveAt(0, 1, EAllowShrinking::No);
+		ComputeLinkPath(L);
+	}
+
+	if (RepathQueue.Num() == 0)
+	{
+		GetWorld()->GetTimerManager().ClearTimer(RepathTimer);
+	}
+}
+
+// ---------- Queries ----------
+
+bool USFW_PatrolGraphSubsystem::IsLinkUsable(const FLink& Link) const
+{
+	if (!Link.bHasPath || Link.bDirty) return false;
+	return Link.Door == INDEX_NONE || !DoorOpen.IsValidIndex(Link.Door) || DoorOpen[Link.Door];
+}
+
+int32 USFW_PatrolGraphSubsystem::FindNearestNode(const FVector& Location) const
+{
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	const int32 Room = RoomSys ? RoomSys->FindRoomIndexAt(Location) : INDEX_NONE;
+
+	int32 Best = INDEX_NONE;
+	int32 BestInRoom = INDEX_NONE;
+	float BestDistSq = MAX_flt;
+	float BestInRoomDistSq = MAX_flt;
+
+	for (int32 N = 0; N < Nodes.Num(); ++N)
+	{
+		const float DistSq = FVector::DistSquared(Nodes[N].Location, Location);
+		if (DistSq < BestDistSq)
+		{
+			BestDistSq = DistSq;
+			Best = N;
+		}
+		if (Room != INDEX_NONE && Nodes[N].Room == Room && DistSq < BestInRoomDistSq)
+		{
+			BestInRoomDistSq = DistSq;
+			BestInRoom = N;
+		}
+	}
+	return BestInRoom != INDEX_NONE ? BestInRoom : Best;
+}
+
+int32 USFW_PatrolGraphSubsystem::ChooseNextNode(int32 From, int32 Previous) const
+{
+	if (!LinkStart.IsValidIndex(From + 1)) return INDEX_NONE;
+
+	TArray<TPair<int32, float>, TInlineAllocator<8>> Options;
+	float Total = 0.f;
+
+	int32 NumUsable = 0;
+	for (int32 L = LinkStart[From]; L < LinkStart[From + 1]; ++L)
+	{
+		NumUsable += IsLinkUsable(Links[L]) ? 1 : 0;
+	}
+
+	for (int32 L = LinkStart[From]; L < LinkStart[From + 1]; ++L)
+	{
+		const FLink& Link = Links[L];
+		if (!IsLinkUsable(Link)) continue;
+
+		float Weight = GetActivityWeight(Nodes[Link.To].Room);
+		if (Link.To == Previous && NumUsable > 1)
+		{
+			Weight *= BacktrackWeight;
+		}
+
+		Options.Emplace(Link.To, Weight);
+		Total += Weight;
+	}
+
+	if (Options.Num() == 0) return INDEX_NONE;
+
+	float Pick = FMath::FRand() * Total;
+	for (const TPair<int32, float>& Option : Options)
+	{
+		Pick -= Option.Value;
+		if (Pick <= 0.f) return Option.Key;
+	}
+	return Options.Last().Key;
+}
+
+const TArray<FVector>* USFW_PatrolGraphSubsystem::FindPath(int32 From, int32 To) const
+{
+	if (!LinkStart.IsValidIndex(From + 1)) return nullptr;
+
+	for (int32 L = LinkStart[From]; L < LinkStart[From + 1]; ++L)
+	{
+		if (Links[L].To == To)
+		{
+			return IsLinkUsable(Links[L]) ? &Links[L].PathPoints : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+int32 USFW_PatrolGraphSubsystem::FindNodeInRoomAwayFrom(int32 Room, TConstArrayView<FVector> Avoid) const
+{
+	int32 Best = INDEX_NONE;
+	float BestDistSq = -1.f;
+
+	for (int32 N = 0; N < Nodes.Num(); ++N)
+	{
+		if (Nodes[N].Room != Room) continue;
+
+		float NearestSq = MAX_flt;
+		for (const FVector& P : Avoid)
+		{
+			NearestSq = FMath::Min(NearestSq, FVector::DistSquared(Nodes[N].Location, P));
+		}
+
+		if (NearestSq > BestDistSq)
+		{
+			BestDistSq = NearestSq;
+			Best = N;
+		}
+	}
+	return Best;
+}
+
+float USFW_PatrolGraphSubsystem::GetActivityWeight(int32 Room) const
+{
+	const int32 Hops = GetActivityHops(Room);
+	return 1.f + (Hops >= 0 ? ActivityWeight / (1.f + Hops) : 0.f);
+}
+
+int32 USFW_PatrolGraphSubsystem::GetActivityHops(int32 Room) const
+{
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	const ASFW_GameState* GS = GetWorld() ? GetWorld()->GetGameState<ASFW_GameState>() : nullptr;
+	if (!RoomSys || !GS || Room == INDEX_NONE) return INDEX_NONE;
+
+	int32 Best = INDEX_NONE;
+	const TArray<TObjectPtr<ARoomVolume>>& Rooms = RoomSys->GetRooms();
+	for (int32 R = 0; R < Rooms.Num(); ++R)
+	{
+		const ARoomVolume* Vol = Rooms[R].Get();
+		if (!Vol || GS->GetRoomOccupancyMask(Vol->GetRoomIndex()) == 0u) continue;
+
+		const int32 Hops = RoomSys->GetHopDistance(Room, R);
+		if (Hops != USFW_RoomSubsystem::UnreachableHops && (Best == INDEX_NONE || Hops < Best))
+		{
+			Best = Hops;
+		}
+	}
+	return Best;
+}
@@ -0,0 +1,15 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/AI/Perception/SFW_AISenseConfig_RoomSight.h"
+
+USFW_AISenseConfig_RoomSight::USFW_AISenseConfig_RoomSight(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	DebugColor = FColor::Purple;
+	Implementation = USFW_AISense_RoomSight::StaticClass();
+}
+
+TSubclassOf<UAISense> USFW_AISenseConfig_RoomSight::GetSenseImplementation() const
+{
+	return Implementation;
+}
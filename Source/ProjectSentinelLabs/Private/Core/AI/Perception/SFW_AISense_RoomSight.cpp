@@ -0,0 +1,290 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/AI/Perception/SFW_AISense_RoomSight.h"
+
+#include "Core/AI/Perception/SFW_AISenseConfig_RoomSight.h"
+#include "Core/Game/SFW_GameState.h"
+#include "Core/Game/SFW_PlayerState.h"
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Rooms/RoomVolume.h"
+
+#include "Perception/AIPerceptionComponent.h"
+#include "GameFramework/Pawn.h"
+#include "Engine/World.h"
+
+USFW_AISense_RoomSight::USFW_AISense_RoomSight(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// Candidates come from room occupancy, not from registered stimulus sources
+	bAutoRegisterAllPawnsAsSources = false;
+	NotifyType = EAISenseNotifyType::OnPerceptionChange;
+
+	OnNewListenerDelegate.BindUObject(this, &USFW_AISense_RoomSight::OnNewListenerImpl);
+	OnListenerUpdateDelegate.BindUObject(this, &USFW_AISense_RoomSight::OnListenerUpdateImpl);
+	OnListenerRemovedDelegate.BindUObject(this, &USFW_AISense_RoomSight::OnListenerRemovedImpl);
+}
+
+// ---------- Listeners ----------
+
+void USFW_AISense_RoomSight::OnNewListenerImpl(const FPerceptionListener& NewListener)
+{
+	FListenerState& State = ListenerStates.FindOrAdd(NewListener.GetListenerID());
+	ApplyConfig(NewListener, State);
+	State.NextRefreshTime = 0.f;
+
+	RequestImmediateUpdate(); // may be suspended with no listeners
+}
+
+void USFW_AISense_RoomSight::OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener)
+{
+	if (!UpdatedListener.HasSense(GetSenseID()))
+	{
+		OnListenerRemovedImpl(UpdatedListener);
+		return;
+	}
+
+	FListenerState& State = ListenerStates.FindOrAdd(UpdatedListener.GetListenerID());
+	ApplyConfig(UpdatedListener, State);
+}
+
+void USFW_AISense_RoomSight::OnListenerRemovedImpl(const FPerceptionListener& RemovedListener)
+{
+	const FPerceptionListenerID Id = RemovedListener.GetListenerID();
+	ListenerStates.Remove(Id);
+
+	for (int32 i = TraceQueueHead; i < TraceQueue.Num(); ++i)
+	{
+		if (TraceQueue[i].ListenerId == Id)
+		{
+			TraceQueue[i].Target.Reset(); // skipped when drained
+		}
+	}
+}
+
+void USFW_AISense_RoomSight::ApplyConfig(const FPerceptionListener& Listener, FListenerState& State) const
+{
+	const UAIPerceptionComponent* Comp = Listener.Listener.Get();
+	const USFW_AISenseConfig_RoomSight* Config = Comp
+		? Cast<const USFW_AISenseConfig_RoomSight>(Comp->GetSenseConfig(GetSenseID()))
+		: nullptr;
+	if (!Config) return;
+
+	State.SightRadiusSq = FMath::Square(Config->SightRadius);
+	State.LoseSightRadiusSq = FMath::Square(FMath::Max(Config->LoseSightRadius, Config->SightRadius));
+	State.CosHalfFOV = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(Config->PeripheralVisionAngleDegrees, 0.f, 180.f)));
+	State.RefreshInterval = Config->CandidateRefreshInterval;
+}
+
+// ---------- Update ----------
+
+float USFW_AISense_RoomSight::Update()
+{
+	UWorld* World = GetWorld();
+	if (!World || ListenerStates.Num() == 0)
+	{
+		return SuspendNextUpdate;
+	}
+
+	const float Now = World->GetTimeSeconds();
+	AIPerception::FListenerMap& Listeners = *GetListeners();
+
+	bool bSlotsBuilt = false;
+	for (auto& Pair : Listeners)
+	{
+		FPerceptionListener& Listener = Pair.Value;
+		FListenerState* State = ListenerStates.Find(Listener.GetListenerID());
+		if (!State || Now < State->NextRefreshTime || !Listener.HasSense(GetSenseID())) continue;
+
+		if (!bSlotsBuilt)
+		{
+			BuildSlotPawns();
+			bSlotsBuilt = true;
+		}
+
+		State->NextRefreshTime = Now + State->RefreshInterval;
+		RefreshCandidates(Listener, *State);
+	}
+
+	// Drain the shared trace budget, oldest request first
+	int32 Budget = MaxTracesPerUpdate;
+	while (Budget > 0 && TraceQueueHead < TraceQueue.Num())
+	{
+		const FPendingTrace Pending = TraceQueue[TraceQueueHead++];
+
+		AActor* Target = Pending.Target.Get();
+		FPerceptionListener* Listener = Listeners.Find(Pending.ListenerId);
+		FListenerState* State = ListenerStates.Find(Pending.ListenerId);
+		if (!Target || !Listener || !State) continue;
+
+		const AActor* Body = Listener->GetBodyActor();
+		const FVector Eye = Listener->CachedLocation;
+		const FVector TargetLoc = Target->GetActorLocation();
+
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(ShadeRoomSight), false, Body);
+		Params.AddIgnoredActor(Target);
+
+		--Budget;
+		const bool bBlocked = World->LineTraceTestByChannel(Eye, TargetLoc, ECC_Visibility, Params);
+		ReportSeen(*Listener, *State, Target, !bBlocked);
+	}
+
+	if (TraceQueueHead >= TraceQueue.Num())
+	{
+		TraceQueue.Reset();
+		TraceQueueHead = 0;
+	}
+	else if (TraceQueueHead > 32)
+	{
+		TraceQueue.RemoveAt(0, TraceQueueHead, EAllowShrinking::No);
+		TraceQueueHead = 0;
+	}
+
+	return 0.f;
+}
+
+void USFW_AISense_RoomSight::BuildSlotPawns()
+{
+	SlotPawns.Reset();
+	SlotPawns.SetNumZeroed(ASFW_GameState::MaxOccupancySlots);
+
+	const ASFW_GameState* GS = GetWorld()->GetGameState<ASFW_GameState>();
+	if (!GS) return;
+
+	for (const APlayerState* PS : GS->PlayerArray)
+	{
+		const ASFW_PlayerState* SFWPS = Cast<ASFW_PlayerState>(PS);
+		if (SFWPS && SlotPawns.IsValidIndex(SFWPS->OccupancySlot))
+		{
+			SlotPawns[SFWPS->OccupancySlot] = SFWPS->GetPawn();
+		}
+	}
+}
+
+void USFW_AISense_RoomSight::RefreshCandidates(FPerceptionListener& Listener, FListenerState& State)
+{
+	const AActor* Body = Listener.GetBodyActor();
+	if (!Body) return;
+
+	const FVector Eye = Listener.CachedLocation;
+	const FVector Forward = Listener.CachedDirection;
+
+	const ASFW_GameState* GS = GetWorld()->GetGameState<ASFW_GameState>();
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+
+	// Occupancy of the Shade's room and every room one open door away
+	uint32 Mask = 0u;
+	bool bInRoom = false;
+	if (GS && RoomSys)
+	{
+		const int32 Room = RoomSys->FindRoomIndexAt(Eye);
+		if (Room != INDEX_NONE)
+		{
+			bInRoom = true;
+
+			TArray<int32, TInlineAllocator<8>> Rooms;
+			Rooms.Add(Room);
+			{
+				TArray<int32> Neighbors;
+				RoomSys->GetNeighborRooms(Room, /*bOpenOnly=*/true, Neighbors);
+				Rooms.Append(Neighbors);
+			}
+
+			const TArray<TObjectPtr<ARoomVolume>>& Volumes = RoomSys->GetRooms();
+			for (const int32 R : Rooms)
+			{
+				if (const ARoomVolume* Vol = Volumes.IsValidIndex(R) ? Volumes[R].Get() : nullptr)
+				{
+					Mask |= GS->GetRoomOccupancyMask(Vol->GetRoomIndex());
+				}
+			}
+		}
+	}
+
+	// Outside the room graph (hallway gaps, outdoors): every player is a candidate
+	if (!bInRoom)
+	{
+		Mask = ~0u;
+	}
+
+	TArray<AActor*, TInlineAllocator<8>> Candidates;
+	for (int32 Slot = 0; Slot < SlotPawns.Num(); ++Slot)
+	{
+		if ((Mask & (1u << Slot)) && SlotPawns[Slot] && SlotPawns[Slot] != Body)
+		{
+			Candidates.Add(SlotPawns[Slot]);
+		}
+	}
+
+	// Already-seen players stay candidates so walking out of the room graph reads as a loss
+	for (int32 i = State.Seen.Num() - 1; i >= 0; --i)
+	{
+		if (AActor* SeenActor = State.Seen[i].Get())
+		{
+			Candidates.AddUnique(SeenActor);
+		}
+		else
+		{
+			State.Seen.RemoveAtSwap(i, 1, EAllowShrinking::No);
+		}
+	}
+
+	for (AActor* Target : Candidates)
+	{
+		const bool bWasSeen = State.Seen.Contains(Target);
+
+		const FVector ToTarget = Target->GetActorLocation() - Eye;
+		const float DistSq = ToTarget.SizeSquared();
+		const float MaxSq = bWasSeen ? State.LoseSightRadiusSq : State.SightRadiusSq;
+
+		bool bPasses = DistSq <= MaxSq;
+		if (bPasses && DistSq > KINDA_SMALL_NUMBER)
+		{
+			bPasses = FVector::DotProduct(ToTarget * FMath::InvSqrt(DistSq), Forward) >= State.CosHalfFOV;
+		}
+
+		if (!bPasses)
+		{
+			if (bWasSeen)
+			{
+				ReportSeen(Listener, State, Target, false); // no trace needed to lose someone
+			}
+			continue;
+		}
+
+		QueueTrace(Listener.GetListenerID(), Target);
+	}
+}
+
+void USFW_AISense_RoomSight::QueueTrace(const FPerceptionListenerID& ListenerId, AActor* Target)
+{
+	for (int32 i = TraceQueueHead; i < TraceQueue.Num(); ++i)
+	{
+		if (TraceQueue[i].ListenerId == ListenerId && TraceQueue[i].Target == Target)
+		{
+			return; // still waiting from an earlier refresh
+		}
+	}
+
+	TraceQueue.Add({ ListenerId, Target });
+}
+
+void USFW_AISense_RoomSight::ReportSeen(FPerceptionListener& Listener, FListenerState& State, AActor* Target, bool bVisible)
+{
+	const int32 SeenIdx = State.Seen.IndexOfByKey(Target);
+	const bool bWasSeen = SeenIdx != INDEX_NONE;
+
+	// OnPerceptionChange: only edges reach the perception component
+	if (bVisible == bWasSeen) return;
+
+	if (bVisible)
+	{
+		State.Seen.Add(Target);
+	}
+	else
+	{
+		State.Seen.RemoveAtSwap(SeenIdx, 1, EAllowShrinking::No);
+	}
+
+	Listener.RegisterStimulus(Target, FAIStimulus(*this, 1.f, Target->GetActorLocation(), Listener.CachedLocation,
+		bVisible ? FAIStimulus::SensingSucceeded : FAIStimulus::SensingFailed));
+}
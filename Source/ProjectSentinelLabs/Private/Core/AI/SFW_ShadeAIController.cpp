@@ -3,10 +3,17 @@
 
 #include "Core/AI/SFW_ShadeAIController.h"
 #include "Perception/AIPerceptionComponent.h"
-#include "Perception/AISenseConfig_Sight.h"
+#include "Core/AI/Perception/SFW_AISenseConfig_RoomSight.h"
 #include "Perception/AIPerceptionTypes.h"
-#include "Kismet/GameplayStatics.h"
-#include "Engine/TargetPoint.h"
+#include "Core/AI/Patrol/SFW_PatrolGraphSubsystem.h"
+#include "NavigationData.h"
+#include "NavigationSystem.h"
+#include "NavFilters/NavigationQueryFilter.h"
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Rooms/RoomVolume.h"
+#include "Core/Game/SFW_GameState.h"
+#include "GameFramework/PlayerState.h"
+#include "Components/CapsuleComponent.h"
 #include "Core/AI/SFW_ShadeCharacterBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Navigation/PathFollowingComponent.h"
@@ -21,15 +28,13 @@ ASFW_ShadeAIController::ASFW_ShadeAIController()
 	PrimaryActorTick.bCanEverTick = true;
 
 	Perception = CreateDefaultSubobject<UAIPerceptionComponent>(TEXT("Perception"));
-	SightConfig = CreateDefaultSubobject<UAISenseConfig_Sight>(TEXT("SightConfig"));
+	SightConfig = CreateDefaultSubobject<USFW_AISenseConfig_RoomSight>(TEXT("SightConfig"));
 
 	// Sight defaults (tune later / scale with aggression)
 	SightConfig->SightRadius = 2000.f;
 	SightConfig->LoseSightRadius = 2300.f;
 	SightConfig->PeripheralVisionAngleDegrees = 80.f;
-	SightConfig->DetectionByAffiliation.bDetectEnemies = true;
-	SightConfig->DetectionByAffiliation.bDetectFriendlies = true;
-	SightConfig->DetectionByAffiliation.bDetectNeutrals = true;
+	SightConfig->CandidateRefreshInterval = 0.2f; // candidates come from room occupancy, see USFW_AISense_RoomSight
 
 	Perception->ConfigureSense(*SightConfig);
 	Perception->SetDominantSense(SightConfig->GetSenseImplementation());
@@ -52,6 +57,15 @@ void ASFW_ShadeAIController::OnPossess(APawn* InPawn)
 
 	BuildPatrolPointList();
 	EnterPatrol();
+
+	bAbstractSim = false;
+	LastPlayersNearTime = GetWorld()->GetTimeSeconds();
+	PathTokens = PathRequestBurst;
+	PathTokenTime = GetWorld()->GetTimeSeconds();
+	if (bEnableLOD)
+	{
+		GetWorld()->GetTimerManager().SetTimer(LODCheckHandle, this, &ASFW_ShadeAIController::UpdateLOD, LODCheckInterval, true);
+	}
 }
 
 void ASFW_ShadeAIController::Tick(float DeltaSeconds)
@@ -68,11 +82,13 @@ void ASFW_ShadeAIController::EnterPatrol()
 	// Stop any timers
 	GetWorld()->GetTimerManager().ClearTimer(SearchTimerHandle);
 	GetWorld()->GetTimerManager().ClearTimer(PatrolWaitHandle);
+	GetWorld()->GetTimerManager().ClearTimer(ChaseRepathHandle);
 
 	// Reset patrol leg state
 	bPatrolLegActive = false;
 	CurrentGoalIndex = INDEX_NONE;
 
+	CancelPathRequests();
 	StopMovement();
 	if (Shade)
 	{
@@ -88,6 +104,13 @@ void ASFW_ShadeAIController::EnterChase(AActor* NewTarget)
 {
 	if (!IsValid(NewTarget)) return;
 
+	// Re-sighting the same target (room edges flicker) only refreshes the path request
+	if (AIState == EShadeAIState::Chase && TargetActor == NewTarget)
+	{
+		UpdateChasePath();
+		return;
+	}
+
 	AIState = EShadeAIState::Chase;
 	TargetActor = NewTarget;
 
@@ -103,7 +126,9 @@ void ASFW_ShadeAIController::EnterChase(AActor* NewTarget)
 		Shade->SetAggressionFactor(1.0f);
 	}
 
-	MoveToActor(TargetActor, 100.f);
+	// Path to where the target is now; the repath timer follows it from there
+	UpdateChasePath();
+	GetWorld()->GetTimerManager().SetTimer(ChaseRepathHandle, this, &ASFW_ShadeAIController::UpdateChasePath, ChaseRepathInterval, true);
 }
 
 void ASFW_ShadeAIController::EnterSearch(const FVector& InLastKnown)
@@ -113,20 +138,19 @@ void ASFW_ShadeAIController::EnterSearch(const FVector& InLastKnown)
 
 	// Stop patrol wait and reset patrol leg state
 	GetWorld()->GetTimerManager().ClearTimer(PatrolWaitHandle);
+	GetWorld()->GetTimerManager().ClearTimer(ChaseRepathHandle);
 	bPatrolLegActive = false;
 	CurrentGoalIndex = INDEX_NONE;
 
-	StopMovement();
-
 	if (Shade)
 	{
 		Shade->SetShadeState(EShadeState::Patrol); // use patrol anims
 		Shade->SetAggressionFactor(0.2f);          // slightly faster than patrol
 	}
 
-	// Move to last known location and start search timer
+	// Move to last known location and start search timer (usually reuses the chase path)
 	LastKnownPos = InLastKnown;
-	MoveToLocation(LastKnownPos, 125.f);
+	RequestPathMove(LastKnownPos, 125.f);
 
 	GetWorld()->GetTimerManager().ClearTimer(SearchTimerHandle);
 	GetWorld()->GetTimerManager().SetTimer(
@@ -163,10 +187,25 @@ void ASFW_ShadeAIController::OnMoveCompleted(FAIRequestID RequestID, const FPath
 {
 	Super::OnMoveCompleted(RequestID, Result);
 
+	// Replaced by a newer path; not the end of anything
+	if (Result.HasFlag(FPathFollowingResultFlags::NewRequest)) return;
+
+	bHasMoveGoal = false;
+
 	if (AIState == EShadeAIState::Chase)
 	{
 		// If we got here, the path finished; unless we still see the target, fall back to search
 		if (!TargetActor) return; // already cleared
+
+		// Reached where the target was, but it has moved on: keep chasing on a fresh path
+		const APawn* MyPawn = GetPawn();
+		if (Result.IsSuccess() && MyPawn
+			&& FVector::DistSquared(TargetActor->GetActorLocation(), MyPawn->GetActorLocation()) > FMath::Square(100.f + PathReuseDistance))
+		{
+			UpdateChasePath();
+			return;
+		}
+
 		EnterSearch(TargetActor->GetActorLocation());
 		return;
 	}
@@ -179,6 +218,8 @@ void ASFW_ShadeAIController::OnMoveCompleted(FAIRequestID RequestID, const FPath
 
 	if (AIState == EShadeAIState::Patrol)
 	{
+		if (bAbstractSim) return; // leg aborted by going abstract
+
 		// Finish current patrol leg
 		bPatrolLegActive = false;
 		CurrentGoalIndex = INDEX_NONE;
@@ -200,36 +241,82 @@ void ASFW_ShadeAIController::OnMoveCompleted(FAIRequestID RequestID, const FPath
 
 void ASFW_ShadeAIController::BuildPatrolPointList()
 {
-	PatrolPoints.Reset();
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ATargetPoint::StaticClass(), PatrolPoints);
+	// Shared graph, built by the subsystem at world begin play; leg paths may still be filling in
+	PatrolGraph = USFW_PatrolGraphSubsystem::Get(this);
+	PatrolIndex = INDEX_NONE;
+	PrevPatrolIndex = INDEX_NONE;
 }
 
 void ASFW_ShadeAIController::StartPatrol()
 {
-	if (PatrolPoints.Num() == 0) return;
-	if (PatrolIndex == INDEX_NONE)
-	{
-		PatrolIndex = FMath::RandRange(0, PatrolPoints.Num() - 1);
-	}
+	if (!PatrolGraph || PatrolGraph->GetNumNodes() == 0) return;
 	MoveToNextPatrolPoint();
 }
 
 void ASFW_ShadeAIController::MoveToNextPatrolPoint()
 {
-	if (PatrolPoints.Num() == 0 || bPatrolLegActive) return;
-
-	// choose next
-	PatrolIndex = (PatrolIndex + 1) % PatrolPoints.Num();
-	CurrentGoalIndex = PatrolIndex;
+	if (!PatrolGraph || bPatrolLegActive || bAbstractSim) return;
 
 	// clear any pending waits
 	GetWorld()->GetTimerManager().ClearTimer(PatrolWaitHandle);
 
-	// start leg
-	if (AActor* Dest = PatrolPoints[CurrentGoalIndex])
+	if (PatrolGraph->GetNumNodes() == 0)
+	{
+		// Possessed before world begin play built the graph; look again shortly
+		if (!PatrolGraph->IsBuilt())
+		{
+			StartPatrolWait();
+		}
+		return;
+	}
+
+	APawn* MyPawn = GetPawn();
+	if (!MyPawn) return;
+
+	const FVector PawnLoc = MyPawn->GetActorLocation();
+
+	// Off the graph (first leg, after chase / search, failed leg): regular move to the nearest node
+	const bool bOnGraph = PatrolIndex != INDEX_NONE
+		&& FVector::DistSquared2D(PawnLoc, PatrolGraph->GetNode(PatrolIndex).Location) <= FMath::Square(PatrolRejoinDistance);
+	if (!bOnGraph)
 	{
+		PrevPatrolIndex = INDEX_NONE;
+		PatrolIndex = PatrolGraph->FindNearestNode(PawnLoc);
+		CurrentGoalIndex = PatrolIndex;
 		bPatrolLegActive = true;
-		MoveToLocation(Dest->GetActorLocation(), /*AcceptanceRadius=*/180.f);
+		RequestPathMove(PatrolGraph->GetNode(PatrolIndex).Location, /*AcceptanceRadius=*/180.f);
+		return;
+	}
+
+	// choose next (weighted toward player activity); every usable link has a cached path
+	const int32 Next = PatrolGraph->ChooseNextNode(PatrolIndex, PrevPatrolIndex);
+	const TArray<FVector>* Points = (Next != INDEX_NONE) ? PatrolGraph->FindPath(PatrolIndex, Next) : nullptr;
+	if (!Points)
+	{
+		// Boxed in by closed doors; wait and look again
+		StartPatrolWait();
+		return;
+	}
+
+	PrevPatrolIndex = PatrolIndex;
+	PatrolIndex = Next;
+	CurrentGoalIndex = Next;
+
+	// start leg on the cached path, no pathfinding query
+	FAIMoveRequest Request(PatrolGraph->GetNode(Next).Location);
+	Request.SetAcceptanceRadius(180.f);
+	Request.SetAllowPartialPath(false);
+
+	FNavPathSharedPtr Path = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(*Points, nullptr);
+	Path->SetQuerier(this);
+
+	CancelPathRequests();
+	bPatrolLegActive = true;
+	if (!RequestMove(Request, Path).IsValid())
+	{
+		bPatrolLegActive = false;
+		PatrolIndex = INDEX_NONE; // rejoin next time
+		StartPatrolWait();
 	}
 }
 
@@ -260,4 +347,361 @@ void ASFW_ShadeAIController::TryAttackTarget()
 	}
 }
 
+// ---------- Async pathing ----------
+
+void ASFW_ShadeAIController::RequestPathMove(const FVector& Goal, float AcceptanceRadius)
+{
+	const float ReuseSq = FMath::Square(PathReuseDistance);
+
+	// Already following a path to (about) here
+	if (bHasMoveGoal && GetMoveStatus() == EPathFollowingStatus::Moving && FVector::DistSquared(Goal, MoveGoal) <= ReuseSq)
+	{
+		bHasPendingPathGoal = false;
+		return;
+	}
+
+	// A query for (about) here is already in flight
+	if (PathQueryId != INVALID_NAVQUERYID && FVector::DistSquared(Goal, PathQueryGoal) <= ReuseSq)
+	{
+		bHasPendingPathGoal = false;
+		return;
+	}
+
+	// Newest goal wins; issued once the in-flight query lands and a token is free
+	bHasPendingPathGoal = true;
+	PendingPathGoal = Goal;
+	PendingPathAcceptance = AcceptanceRadius;
+	FlushPendingPathRequest();
+}
+
+void ASFW_ShadeAIController::CancelPathRequests()
+{
+	if (PathQueryId != INVALID_NAVQUERYID)
+	{
+		if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+		{
+			NavSys->AbortAsyncFindPathRequest(PathQueryId);
+		}
+		PathQueryId = INVALID_NAVQUERYID;
+	}
+
+	bHasPendingPathGoal = false;
+	bHasMoveGoal = false;
+	GetWorld()->GetTimerManager().ClearTimer(PathRetryHandle);
+}
+
+bool ASFW_ShadeAIController::ConsumePathToken()
+{
+	const float Now = GetWorld()->GetTimeSeconds();
+	PathTokens = FMath::Min(static_cast<float>(PathRequestBurst), PathTokens + (Now - PathTokenTime) * PathRequestsPerSecond);
+	PathTokenTime = Now;
+
+	if (PathTokens < 1.f) return false;
+	PathTokens -= 1.f;
+	return true;
+}
+
+void ASFW_ShadeAIController::FlushPendingPathRequest()
+{
+	if (!bHasPendingPathGoal || PathQueryId != INVALID_NAVQUERYID) return;
+
+	if (!ConsumePathToken())
+	{
+		// Out of budget: try again when the next token is in
+		if (!GetWorld()->GetTimerManager().IsTimerActive(PathRetryHandle))
+		{
+			const float Wait = (1.f - PathTokens) / FMath::Max(PathRequestsPerSecond, 0.1f);
+			GetWorld()->GetTimerManager().SetTimer(PathRetryHandle, this, &ASFW_ShadeAIController::FlushPendingPathRequest, FMath::Max(Wait, 0.01f), false);
+		}
+		return;
+	}
+
+	bHasPendingPathGoal = false;
+	IssuePathQuery(PendingPathGoal, PendingPathAcceptance);
+}
+
+void ASFW_ShadeAIController::IssuePathQuery(const FVector& Goal, float AcceptanceRadius)
+{
+	UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+	const ANavigationData* NavData = NavSys ? NavSys->GetNavDataForProps(GetNavAgentPropertiesRef(), GetNavAgentLocation()) : nullptr;
+	if (!GetPawn() || !NavData)
+	{
+		OnPathRequestFailed();
+		return;
+	}
+
+	FPathFindingQuery Query(this, *NavData, GetNavAgentLocation(), Goal,
+		UNavigationQueryFilter::GetQueryFilter(*NavData, this, GetDefaultNavigationFilterClass()));
+	Query.SetAllowPartialPaths(true);
+
+	PathQueryGoal = Goal;
+	PathQueryAcceptance = AcceptanceRadius;
+	PathQueryId = NavSys->FindPathAsync(GetNavAgentPropertiesRef(), Query,
+		FNavPathQueryDelegate::CreateUObject(this, &ASFW_ShadeAIController::OnPathQueryDone));
+
+	if (PathQueryId == INVALID_NAVQUERYID)
+	{
+		OnPathRequestFailed();
+	}
+}
+
+void ASFW_ShadeAIController::OnPathQueryDone(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path)
+{
+	if (QueryId != PathQueryId) return; // cancelled or superseded
+	PathQueryId = INVALID_NAVQUERYID;
+
+	if (bAbstractSim) return;
+
+	bool bMoving = false;
+	if (Result == ENavigationQueryResult::Success && Path.IsValid() && Path->IsValid())
+	{
+		FAIMoveRequest Request(PathQueryGoal);
+		Request.SetAcceptanceRadius(PathQueryAcceptance);
+		Request.SetAllowPartialPath(true);
+
+		if (RequestMove(Request, Path).IsValid())
+		{
+			bHasMoveGoal = true;
+			MoveGoal = PathQueryGoal;
+			bMoving = true;
+		}
+	}
 
+	// A goal that queued up meanwhile but is covered by this path needs no query of its own
+	if (bMoving && bHasPendingPathGoal && FVector::DistSquared(PendingPathGoal, MoveGoal) <= FMath::Square(PathReuseDistance))
+	{
+		bHasPendingPathGoal = false;
+	}
+
+	if (!bMoving && !bHasPendingPathGoal)
+	{
+		OnPathRequestFailed();
+		return;
+	}
+
+	FlushPendingPathRequest();
+}
+
+void ASFW_ShadeAIController::OnPathRequestFailed()
+{
+	// Chase retries on its repath timer; Search waits out its timer
+	if (AIState != EShadeAIState::Patrol || bAbstractSim) return;
+
+	// Same recovery as a failed patrol leg
+	bPatrolLegActive = false;
+	CurrentGoalIndex = INDEX_NONE;
+	GetWorld()->GetTimerManager().SetTimer(PatrolWaitHandle, this, &ASFW_ShadeAIController::MoveToNextPatrolPoint, 1.f, false);
+}
+
+void ASFW_ShadeAIController::UpdateChasePath()
+{
+	if (AIState != EShadeAIState::Chase || !IsValid(TargetActor))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(ChaseRepathHandle);
+		return;
+	}
+
+	RequestPathMove(TargetActor->GetActorLocation(), 100.f);
+}
+
+// ---------- LOD ----------
+
+bool ASFW_ShadeAIController::ArePlayersNearRoom(int32 Room) const
+{
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	const ASFW_GameState* GS = GetWorld()->GetGameState<ASFW_GameState>();
+	if (!RoomSys || !GS || Room == INDEX_NONE) return true; // unknown: stay at full detail
+
+	TArray<int32> Rooms;
+	RoomSys->GetNeighborRooms(Room, /*bOpenOnly=*/false, Rooms);
+	Rooms.Add(Room);
+
+	const TArray<TObjectPtr<ARoomVolume>>& Volumes = RoomSys->GetRooms();
+	for (const int32 R : Rooms)
+	{
+		const ARoomVolume* Vol = Volumes.IsValidIndex(R) ? Volumes[R].Get() : nullptr;
+		if (Vol && GS->GetRoomOccupancyMask(Vol->GetRoomIndex()) != 0u)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void ASFW_ShadeAIController::UpdateLOD()
+{
+	if (!Shade) return;
+
+	if (bAbstractSim)
+	{
+		if (ArePlayersNearRoom(AbstractRoom))
+		{
+			ExitAbstractSim();
+		}
+		return;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	const int32 Room = RoomSys ? RoomSys->FindRoomIndexAt(Shade->GetActorLocation()) : INDEX_NONE;
+
+	// Only an idle patrol goes abstract; chase / search always run in full
+	if (AIState != EShadeAIState::Patrol || ArePlayersNearRoom(Room))
+	{
+		LastPlayersNearTime = Now;
+		return;
+	}
+
+	if (Now - LastPlayersNearTime >= LODEnterDelay)
+	{
+		EnterAbstractSim(Room);
+	}
+}
+
+void ASFW_ShadeAIController::EnterAbstractSim(int32 Room)
+{
+	bAbstractSim = true;
+	AbstractRoom = Room;
+
+	GetWorld()->GetTimerManager().ClearTimer(PatrolWaitHandle);
+	GetWorld()->GetTimerManager().ClearTimer(SearchTimerHandle);
+	bPatrolLegActive = false;
+	CurrentGoalIndex = INDEX_NONE;
+	PatrolIndex = INDEX_NONE;
+	PrevPatrolIndex = INDEX_NONE;
+	GetWorld()->GetTimerManager().ClearTimer(ChaseRepathHandle);
+	CancelPathRequests();
+	StopMovement();
+
+	if (Perception && SightConfig)
+	{
+		Perception->SetSenseEnabled(SightConfig->GetSenseImplementation(), false);
+	}
+	SetActorTickEnabled(false);
+
+	if (Shade)
+	{
+		Shade->SetAbstractSimulation(true);
+	}
+
+	ScheduleAbstractHop();
+	UE_LOG(LogTemp, Verbose, TEXT("[ShadeLOD] %s abstract in room %d"), *GetNameSafe(Shade), Room);
+}
+
+void ASFW_ShadeAIController::ExitAbstractSim()
+{
+	GetWorld()->GetTimerManager().ClearTimer(AbstractHopHandle);
+	bAbstractSim = false;
+
+	// Place in the abstract room, as far from the players as its patrol points allow
+	TArray<FVector, TInlineAllocator<8>> PlayerLocs;
+	if (const ASFW_GameState* GS = GetWorld()->GetGameState<ASFW_GameState>())
+	{
+		for (const APlayerState* PS : GS->PlayerArray)
+		{
+			if (const APawn* P = PS ? PS->GetPawn() : nullptr)
+			{
+				PlayerLocs.Add(P->GetActorLocation());
+			}
+		}
+	}
+
+	const int32 Node = PatrolGraph ? PatrolGraph->FindNodeInRoomAwayFrom(AbstractRoom, PlayerLocs) : INDEX_NONE;
+
+	if (Shade)
+	{
+		Shade->SetAbstractSimulation(false);
+
+		bool bHasSpot = Node != INDEX_NONE;
+		FVector Spot = bHasSpot ? PatrolGraph->GetNode(Node).Location : FVector::ZeroVector;
+		if (!bHasSpot)
+		{
+			const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+			const ARoomVolume* Vol = (RoomSys && RoomSys->GetRooms().IsValidIndex(AbstractRoom)) ? RoomSys->GetRooms()[AbstractRoom].Get() : nullptr;
+			if (Vol)
+			{
+				Spot = Vol->GetActorLocation();
+				bHasSpot = true;
+			}
+		}
+
+		if (bHasSpot)
+		{
+			if (UNavigationSystemV1* NavSys = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+			{
+				FNavLocation OnNav;
+				if (NavSys->ProjectPointToNavigation(Spot, OnNav))
+				{
+					Spot = OnNav.Location;
+				}
+			}
+			Spot.Z += Shade->GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+			Shade->TeleportTo(Spot, Shade->GetActorRotation());
+		}
+	}
+
+	if (Perception && SightConfig)
+	{
+		Perception->SetSenseEnabled(SightConfig->GetSenseImplementation(), true);
+	}
+	SetActorTickEnabled(true);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[ShadeLOD] %s full in room %d"), *GetNameSafe(Shade), AbstractRoom);
+
+	AbstractRoom = INDEX_NONE;
+	LastPlayersNearTime = GetWorld()->GetTimeSeconds();
+
+	EnterPatrol();
+	PatrolIndex = Node; // already standing on it, so the next leg uses a cached path
+}
+
+void ASFW_ShadeAIController::ScheduleAbstractHop()
+{
+	const float Delay = FMath::RandRange(AbstractHopMin, AbstractHopMax);
+	GetWorld()->GetTimerManager().SetTimer(AbstractHopHandle, this, &ASFW_ShadeAIController::AbstractHop, Delay, false);
+}
+
+void ASFW_ShadeAIController::AbstractHop()
+{
+	if (!bAbstractSim) return;
+
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this);
+	TArray<int32> Neighbors;
+	if (RoomSys)
+	{
+		RoomSys->GetNeighborRooms(AbstractRoom, /*bOpenOnly=*/true, Neighbors);
+	}
+
+	// Same drift toward player activity as the full patrol
+	if (Neighbors.Num() > 0)
+	{
+		float Total = 0.f;
+		TArray<float, TInlineAllocator<8>> Weights;
+		for (const int32 R : Neighbors)
+		{
+			Weights.Add(PatrolGraph ? PatrolGraph->GetActivityWeight(R) : 1.f);
+			Total += Weights.Last();
+		}
+
+		float Pick = FMath::FRand() * Total;
+		int32 Chosen = Neighbors.Last();
+		for (int32 i = 0; i < Neighbors.Num(); ++i)
+		{
+			Pick -= Weights[i];
+			if (Pick <= 0.f)
+			{
+				Chosen = Neighbors[i];
+				break;
+			}
+		}
+		AbstractRoom = Chosen;
+	}
+
+	if (ArePlayersNearRoom(AbstractRoom))
+	{
+		ExitAbstractSim();
+		return;
+	}
+
+	ScheduleAbstractHop();
+}
@@ -2,6 +2,7 @@
 
 #include "Core/AI/SFW_ShadeCharacterBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "Net/UnrealNetwork.h"
 
 ASFW_ShadeCharacterBase::ASFW_ShadeCharacterBase()
@@ -28,6 +29,7 @@ void ASFW_ShadeCharacterBase::GetLifetimeReplicatedProps(TArray<FLifetimePropert
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
     DOREPLIFETIME(ASFW_ShadeCharacterBase, ShadeState);
+    DOREPLIFETIME(ASFW_ShadeCharacterBase, bAbstractSimulation);
 }
 
 void ASFW_ShadeCharacterBase::SetAggressionFactor(float InFactor)
@@ -48,6 +50,41 @@ void ASFW_ShadeCharacterBase::OnRep_ShadeState()
     ApplyMovementSpeed();
 }
 
+void ASFW_ShadeCharacterBase::SetAbstractSimulation(bool bAbstract)
+{
+    if (!HasAuthority() || bAbstractSimulation == bAbstract) return;
+    bAbstractSimulation = bAbstract;
+
+    SetActorHiddenInGame(bAbstract); // replicated
+    ApplyAbstractSimulation();
+}
+
+void ASFW_ShadeCharacterBase::OnRep_AbstractSimulation()
+{
+    ApplyAbstractSimulation();
+}
+
+void ASFW_ShadeCharacterBase::ApplyAbstractSimulation()
+{
+    const bool bFull = !bAbstractSimulation;
+
+    SetActorEnableCollision(bFull);
+
+    if (UCharacterMovementComponent* Move = GetCharacterMovement())
+    {
+        if (!bFull)
+        {
+            Move->StopMovementImmediately();
+        }
+        Move->SetComponentTickEnabled(bFull);
+    }
+
+    if (USkeletalMeshComponent* SkelMesh = GetMesh())
+    {
+        SkelMesh->SetComponentTickEnabled(bFull);
+    }
+}
+
 void ASFW_ShadeCharacterBase::ApplyMovementSpeed()
 {
     if (UCharacterMovementComponent* Move = GetCharacterMovement())
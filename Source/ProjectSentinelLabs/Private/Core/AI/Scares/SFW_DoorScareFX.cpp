@@ -1,15 +1,18 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Core/AI/Scares/SFW_DoorScareFX.h"
+#include "Core/AI/Scares/SFW_DoorScareFXPoolSubsystem.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Animation/AnimInstance.h"
 #include "Animation/AnimMontage.h"
+#include "TimerManager.h"
 
 ASFW_DoorScareFX::ASFW_DoorScareFX()
 {
 	PrimaryActorTick.bCanEverTick = false;
 
-	bReplicates = true;
+	// Cosmetic, driven locally by the door's replicated SlamEvent
+	bReplicates = false;
 	SetReplicateMovement(false);
 
 	ScareMesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("ScareMesh"));
@@ -17,23 +20,76 @@ ASFW_DoorScareFX::ASFW_DoorScareFX()
 
 	if (ScareMesh)
 	{
-		ScareMesh->SetIsReplicated(true);
 		ScareMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		ScareMesh->SetCanEverAffectNavigation(false);
+		ScareMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
 	}
 }
 
-void ASFW_DoorScareFX::BeginPlay()
+void ASFW_DoorScareFX::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	Super::BeginPlay();
+	GetWorldTimerManager().ClearTimer(Timer_Finish);
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASFW_DoorScareFX::PlayScare(const FTransform& Where, float InLifetime, USceneComponent* AttachTo)
+{
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	SetActorTransform(Where, false, nullptr, ETeleportType::TeleportPhysics);
+	if (AttachTo)
+	{
+		AttachToComponent(AttachTo, FAttachmentTransformRules::KeepWorldTransform);
+	}
+
+	bPlaying = true;
+	SetActorHiddenInGame(false);
+
+	if (ScareMesh)
+	{
+		ScareMesh->SetComponentTickEnabled(true);
+
+		// Montage is a hard ref on the class and the anim instance was built at prewarm
+		if (ScareMontage)
+		{
+			if (UAnimInstance* AnimInst = ScareMesh->GetAnimInstance())
+			{
+				AnimInst->Montage_Play(ScareMontage, MontagePlayRate, EMontagePlayReturnType::MontageLength, 0.f, /*bStopAllMontages*/ true);
+			}
+		}
+	}
 
-	// play montage on spawn if provided
-	if (ScareMontage && ScareMesh)
+	OnScarePlayed();
+
+	const float Seconds = (InLifetime > 0.f) ? InLifetime : Lifetime;
+	GetWorldTimerManager().SetTimer(Timer_Finish, this, &ASFW_DoorScareFX::FinishScare, FMath::Max(Seconds, 0.05f), false);
+}
+
+void ASFW_DoorScareFX::ParkScare()
+{
+	GetWorldTimerManager().ClearTimer(Timer_Finish);
+	bPlaying = false;
+
+	if (ScareMesh)
 	{
 		if (UAnimInstance* AnimInst = ScareMesh->GetAnimInstance())
 		{
-			AnimInst->Montage_Play(ScareMontage, MontagePlayRate);
+			AnimInst->Montage_Stop(0.f);
 		}
+		ScareMesh->SetComponentTickEnabled(false);
 	}
 
-	if (Lifetime > 0.f) SetLifeSpan(Lifetime);
+	DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+	SetActorHiddenInGame(true);
+}
+
+void ASFW_DoorScareFX::FinishScare()
+{
+	if (USFW_DoorScareFXPoolSubsystem* Pool = USFW_DoorScareFXPoolSubsystem::Get(this))
+	{
+		Pool->Release(this);
+	}
+	else
+	{
+		Destroy();
+	}
 }
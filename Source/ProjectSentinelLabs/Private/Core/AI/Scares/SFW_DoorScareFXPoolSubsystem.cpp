@@ -0,0 +1,142 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/AI/Scares/SFW_DoorScareFXPoolSubsystem.h"
+#include "Core/AI/Scares/SFW_DoorScareFX.h"
+#include "Core/Actors/SFW_DoorBase.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+USFW_DoorScareFXPoolSubsystem* USFW_DoorScareFXPoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_DoorScareFXPoolSubsystem>() : nullptr;
+}
+
+bool USFW_DoorScareFXPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Purely cosmetic; nothing to draw on a dedicated server.
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool USFW_DoorScareFXPoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_DoorScareFXPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	TSet<UClass*> Classes;
+	for (TActorIterator<ASFW_DoorBase> It(&InWorld); It; ++It)
+	{
+		if (UClass* FXClass = It->GetScareFXClass())
+		{
+			Classes.Add(FXClass);
+		}
+	}
+
+	for (UClass* FXClass : Classes)
+	{
+		Prewarm(FXClass, PrewarmPerClass);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[ScareFXPool] Prewarmed %d scare classes"), Classes.Num());
+}
+
+void USFW_DoorScareFXPoolSubsystem::Deinitialize()
+{
+	// Actors go down with the world
+	Buckets.Reset();
+	Super::Deinitialize();
+}
+
+ASFW_DoorScareFX* USFW_DoorScareFXPoolSubsystem::SpawnPooled(UClass* Class)
+{
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+
+	ASFW_DoorScareFX* FX = GetWorld()->SpawnActor<ASFW_DoorScareFX>(Class, FTransform::Identity, Params);
+	if (FX)
+	{
+		FX->ParkScare();
+	}
+	return FX;
+}
+
+void USFW_DoorScareFXPoolSubsystem::Prewarm(TSubclassOf<ASFW_DoorScareFX> Class, int32 Count)
+{
+	if (!Class || Count <= 0)
+	{
+		return;
+	}
+
+	FSFWDoorScareFXBucket& Bucket = Buckets.FindOrAdd(Class.Get());
+	Bucket.Free.Reserve(Count);
+
+	while (Bucket.Free.Num() < Count)
+	{
+		ASFW_DoorScareFX* FX = SpawnPooled(Class);
+		if (!FX)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[ScareFXPool] Failed to prewarm %s"), *GetNameSafe(Class));
+			return;
+		}
+		Bucket.Free.Add(FX);
+	}
+}
+
+ASFW_DoorScareFX* USFW_DoorScareFXPoolSubsystem::Play(TSubclassOf<ASFW_DoorScareFX> Class, const FTransform& Where, float Lifetime, USceneComponent* AttachTo)
+{
+	if (!Class)
+	{
+		return nullptr;
+	}
+
+	ASFW_DoorScareFX* FX = nullptr;
+
+	if (FSFWDoorScareFXBucket* Bucket = Buckets.Find(Class.Get()))
+	{
+		while (!FX && Bucket->Free.Num() > 0)
+		{
+			FX = Bucket->Free.Pop(EAllowShrinking::No);
+			if (!IsValid(FX))
+			{
+				FX = nullptr;
+			}
+		}
+	}
+
+	if (!FX)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[ScareFXPool] %s bucket empty, spawning"), *GetNameSafe(Class));
+		FX = SpawnPooled(Class);
+		if (!FX)
+		{
+			return nullptr;
+		}
+	}
+
+	FX->PlayScare(Where, Lifetime, AttachTo);
+	return FX;
+}
+
+void USFW_DoorScareFXPoolSubsystem::Release(ASFW_DoorScareFX* FX)
+{
+	if (!IsValid(FX))
+	{
+		return;
+	}
+
+	FSFWDoorScareFXBucket& Bucket = Buckets.FindOrAdd(FX->GetClass());
+	FX->ParkScare();
+	Bucket.Free.AddUnique(FX);
+}
+
+int32 USFW_DoorScareFXPoolSubsystem::GetNumFree(TSubclassOf<ASFW_DoorScareFX> Class) const
+{
+	const FSFWDoorScareFXBucket* Bucket = Buckets.Find(Class.Get());
+	return Bucket ? Bucket->Free.Num() : 0;
+}
@@ -3,3 +3,14 @@
 
 #include "Core/Actors/Data/SFW_HandHeldItemDataAsset.h"
 
+
+void USFW_HandHeldItemDataAsset::GetPresentationAssets(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FSoftObjectPath& Path : { IESProfile.ToSoftObjectPath(), PowerOnSFX.ToSoftObjectPath(), PowerOffSFX.ToSoftObjectPath(), UseSFX.ToSoftObjectPath() })
+	{
+		if (Path.IsValid())
+		{
+			OutPaths.Add(Path);
+		}
+	}
+}
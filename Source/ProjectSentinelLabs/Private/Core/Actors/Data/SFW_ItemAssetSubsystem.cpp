@@ -0,0 +1,117 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Actors/Data/SFW_ItemAssetSubsystem.h"
+#include "Core/Actors/Data/SFW_HandHeldItemDataAsset.h"
+
+#include "Engine/World.h"
+
+USFW_ItemAssetSubsystem* USFW_ItemAssetSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_ItemAssetSubsystem>() : nullptr;
+}
+
+bool USFW_ItemAssetSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nothing is heard or seen on a dedicated server.
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool USFW_ItemAssetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_ItemAssetSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<UObject>, FEntry>& Pair : Entries)
+	{
+		if (Pair.Value.Handle.IsValid())
+		{
+			Pair.Value.Handle->ReleaseHandle();
+		}
+	}
+	Entries.Reset();
+	Super::Deinitialize();
+}
+
+void USFW_ItemAssetSubsystem::Retain(const USFW_HandHeldItemDataAsset* Data, FSimpleDelegate OnLoaded)
+{
+	if (!Data)
+	{
+		return;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	Data->GetPresentationAssets(Paths);
+	Retain(Data, MoveTemp(Paths), MoveTemp(OnLoaded));
+}
+
+void USFW_ItemAssetSubsystem::Retain(const UObject* Source, TArray<FSoftObjectPath> Paths, FSimpleDelegate OnLoaded)
+{
+	if (!Source)
+	{
+		return;
+	}
+
+	const TObjectKey<UObject> Key(Source);
+	FEntry& Entry = Entries.FindOrAdd(Key);
+	++Entry.Holders;
+
+	if (Entry.Holders == 1)
+	{
+		if (Paths.Num() > 0)
+		{
+			Entry.Handle = Streamable.RequestAsyncLoad(MoveTemp(Paths),
+				FStreamableDelegate::CreateUObject(this, &USFW_ItemAssetSubsystem::HandleLoaded, Key));
+		}
+	}
+
+	if (!Entry.Handle.IsValid() || Entry.Handle->HasLoadCompleted())
+	{
+		OnLoaded.ExecuteIfBound();
+	}
+	else if (OnLoaded.IsBound())
+	{
+		Entry.Waiting.Add(MoveTemp(OnLoaded));
+	}
+}
+
+void USFW_ItemAssetSubsystem::Release(const UObject* Source)
+{
+	const TObjectKey<UObject> Key(Source);
+	FEntry* Entry = Source ? Entries.Find(Key) : nullptr;
+	if (!Entry || --Entry->Holders > 0)
+	{
+		return;
+	}
+
+	if (Entry->Handle.IsValid())
+	{
+		// Still streaming: cancel. Loaded: let GC have them.
+		if (Entry->Handle->HasLoadCompleted())
+		{
+			Entry->Handle->ReleaseHandle();
+		}
+		else
+		{
+			Entry->Handle->CancelHandle();
+		}
+	}
+	Entries.Remove(Key);
+}
+
+void USFW_ItemAssetSubsystem::HandleLoaded(TObjectKey<UObject> Key)
+{
+	FEntry* Entry = Entries.Find(Key);
+	if (!Entry)
+	{
+		return;
+	}
+
+	TArray<FSimpleDelegate> Waiting = MoveTemp(Entry->Waiting);
+	for (FSimpleDelegate& Callback : Waiting)
+	{
+		Callback.ExecuteIfBound();
+	}
+}
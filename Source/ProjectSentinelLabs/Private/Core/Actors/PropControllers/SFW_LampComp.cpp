@@ -4,6 +4,7 @@
 #include "Core/Actors/PropControllers/SFW_LampComp.h"
 
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "EngineUtils.h"
 #include "Core/AnomalySystems/SFW_AnomalyDecisionSystem.h"
 
@@ -38,6 +39,12 @@ void USFW_LampComp::BeginPlay()
 	if (GetOwnerRole() == ROLE_Authority)
 	{
 		RecomputeMode();
+
+		// Lamps only change on toggle/power/flicker; each of those flushes dormancy.
+		if (GetOwner()->NetDormancy == DORM_Awake)
+		{
+			GetOwner()->SetNetDormancy(DORM_DormantAll);
+		}
 	}
 	else
 	{
@@ -48,10 +55,13 @@ void USFW_LampComp::BeginPlay()
 void USFW_LampComp::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(USFW_LampComp, bHasPower);
-	DOREPLIFETIME(USFW_LampComp, bDesiredOn);
-	DOREPLIFETIME(USFW_LampComp, FlickerEndSec);
-	DOREPLIFETIME(USFW_LampComp, Mode);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_LampComp, bHasPower, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_LampComp, bDesiredOn, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_LampComp, FlickerEndSec, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_LampComp, Mode, Params);
 }
 
 void USFW_LampComp::OnRep_Mode()
@@ -66,7 +76,9 @@ void USFW_LampComp::OnRep_Mode()
 
 void USFW_LampComp::ServerPlayerToggle_Implementation()
 {
+	GetOwner()->FlushNetDormancy();
 	bDesiredOn = !bDesiredOn;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampComp, bDesiredOn, this);
 	UE_LOG(LogTemp, Warning,
 		TEXT("[LampComp] %s ServerPlayerToggle DesiredOn=%d"),
 		*GetOwner()->GetName(),
@@ -79,7 +91,9 @@ void USFW_LampComp::OnPowerChanged(bool bPowered)
 {
 	if (GetOwnerRole() != ROLE_Authority) return;
 
+	GetOwner()->FlushNetDormancy();
 	bHasPower = bPowered;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampComp, bHasPower, this);
 	UE_LOG(LogTemp, Warning,
 		TEXT("[LampComp] %s OnPowerChanged HasPower=%d"),
 		*GetOwner()->GetName(),
@@ -103,7 +117,9 @@ void USFW_LampComp::HandleDecisionBP(const FSFWDecisionPayload& P)
 	{
 		if (GetOwnerRole() == ROLE_Authority)
 		{
+			GetOwner()->FlushNetDormancy();
 			FlickerEndSec = GetWorld()->GetTimeSeconds() + P.Duration;
+			MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampComp, FlickerEndSec, this);
 			RecomputeMode();
 		}
 		else if (Mode == ESFWLampMode::On)
@@ -137,7 +153,9 @@ void USFW_LampComp::RecomputeMode()
 
 	if (NewMode != Mode)
 	{
+		GetOwner()->FlushNetDormancy();
 		Mode = NewMode;
+		MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampComp, Mode, this);
 		ApplyMode(false);
 	}
 }
@@ -5,36 +5,26 @@
 
 #include "Core/Actors/SFW_Camera.h"
 
-#include "Components/StaticMeshComponent.h"
-#include "Components/PrimitiveComponent.h"
-#include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Character.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 ASFW_Camera::ASFW_Camera()
 {
-	PrimaryActorTick.bCanEverTick = false;
-	bReplicates = true;
-	bNetUseOwnerRelevancy = true;
+	CreateDeviceComponents(TEXT("CameraMesh"));
 
 	// One-handed tool grip for now
 	EquipSlot = ESFWEquipSlot::Hand_Tool;
-
-	// Root skeletal mesh comes from EquippableBase::Mesh
-
-	CameraMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("CameraMesh"));
-	CameraMesh->SetupAttachment(GetMesh());
-	CameraMesh->SetIsReplicated(true);
-	CameraMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	CameraMesh->SetCastShadow(true);
-	CameraMesh->SetVisibility(true, true);
 }
 
-UPrimitiveComponent* ASFW_Camera::GetPhysicsComponent() const
+void ASFW_Camera::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	// Use the static mesh as physics body when dropped
-	return CameraMesh ? CameraMesh : Super::GetPhysicsComponent();
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_Camera, ShutterEvent, Params);
 }
 
 EHeldItemType ASFW_Camera::GetAnimHeldType_Implementation() const
@@ -42,31 +32,6 @@ EHeldItemType ASFW_Camera::GetAnimHeldType_Implementation() const
 	return EHeldItemType::Camera;
 }
 
-void ASFW_Camera::OnEquipped(ACharacter* NewOwnerChar)
-{
-	Super::OnEquipped(NewOwnerChar);
-
-	if (CameraMesh)
-	{
-		CameraMesh->SetSimulatePhysics(false);
-		CameraMesh->SetEnableGravity(false);
-		CameraMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		CameraMesh->SetVisibility(true, true);
-	}
-}
-
-void ASFW_Camera::OnUnequipped()
-{
-	if (CameraMesh)
-	{
-		CameraMesh->SetSimulatePhysics(false);
-		CameraMesh->SetEnableGravity(false);
-		CameraMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	}
-
-	Super::OnUnequipped();
-}
-
 void ASFW_Camera::PrimaryUse()
 {
 	// Only the local owning player should initiate a shutter
@@ -97,16 +62,29 @@ void ASFW_Camera::HandleShutterFired_Server()
 {
 	// TODO: later hook in actual gameplay (evidence capture, traces, etc.)
 
-	// Cosmetic for everyone
-	Multicast_PlayShutterFX();
+	// Cosmetic for everyone nearby
+	FlushNetDormancy();
+	ShutterEvent.Fire(this, 1, GetActorLocation());
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_Camera, ShutterEvent, this);
+
+	OnRep_ShutterEvent();
+}
+
+void ASFW_Camera::OnRep_ShutterEvent()
+{
+	// A click from seconds ago is noise
+	if (ShutterReceiver.Receive(this, ShutterEvent, 0.5f) == ESFWCosmeticEventReceipt::Play)
+	{
+		PlayShutterFX();
+	}
 }
 
-void ASFW_Camera::Multicast_PlayShutterFX_Implementation()
+void ASFW_Camera::PlayShutterFX()
 {
-	// Shutter click for all clients
-	if (ShutterSFX)
+	// Shutter click
+	if (USoundBase* SFX = GetUseSFX())
 	{
-		UGameplayStatics::PlaySoundAtLocation(this, ShutterSFX, GetActorLocation());
+		UGameplayStatics::PlaySoundAtLocation(this, SFX, GetActorLocation());
 	}
 
 	// Later: small light flash, camera recoil anim, etc.
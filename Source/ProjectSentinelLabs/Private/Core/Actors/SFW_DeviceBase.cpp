@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Actors/SFW_DeviceBase.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Components/AudioComponent.h"
+#include "Components/BoxComponent.h"
+#include "Engine/StaticMesh.h"
+#include "GameFramework/Character.h"
+#include "Kismet/GameplayStatics.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+ASFW_DeviceBase::ASFW_DeviceBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.DoNotCreateDefaultSubobject(TEXT("Mesh")))
+{
+	PrimaryActorTick.bCanEverTick = false;
+	bReplicates = true;
+	bNetUseOwnerRelevancy = true;
+
+	// DeviceMesh / LoopAudio come from CreateDeviceComponents in each subclass constructor
+}
+
+void ASFW_DeviceBase::CreateDeviceComponents(FName MeshName, FName LoopAudioName)
+{
+	// Root + visual + physics body. Not component-replicated; ReplicatedMovement moves the root.
+	DeviceMesh = CreateDefaultSubobject<UStaticMeshComponent>(MeshName);
+	SetRootComponent(DeviceMesh);
+	DeviceMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	DeviceMesh->SetCastShadow(true);
+
+	if (InteractionCollision)
+	{
+		InteractionCollision->SetupAttachment(DeviceMesh);
+	}
+
+	LoopAudio = CreateDefaultSubobject<UAudioComponent>(LoopAudioName);
+	LoopAudio->SetupAttachment(DeviceMesh);
+	LoopAudio->bAutoActivate = false;
+}
+
+void ASFW_DeviceBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_DeviceBase, Power, Params);
+}
+
+void ASFW_DeviceBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	RefreshPowerState();
+}
+
+// ---------- Equippable ----------
+
+void ASFW_DeviceBase::OnEquipped(ACharacter* NewOwnerChar)
+{
+	Super::OnEquipped(NewOwnerChar);
+	UpdateLoopAudio();
+}
+
+void ASFW_DeviceBase::OnUnequipped()
+{
+	Super::OnUnequipped();
+	UpdateLoopAudio();
+}
+
+void ASFW_DeviceBase::OnDropped(const FVector& DropLocation, const FVector& TossVelocity)
+{
+	Super::OnDropped(DropLocation, TossVelocity);
+	UpdateLoopAudio();
+}
+
+void ASFW_DeviceBase::OnPlaced(const FTransform& WorldTransform)
+{
+	Super::OnPlaced(WorldTransform);
+	UpdateLoopAudio();
+}
+
+void ASFW_DeviceBase::OnReturnedToPool()
+{
+	// Switch off while still awake (SetPowered flushes dormancy), silently; Super hides and goes dormant last
+	bSuppressPowerSFX = true;
+	SetPowered(false);
+	bSuppressPowerSFX = false;
+
+	Super::OnReturnedToPool();
+	UpdateLoopAudio();
+}
+
+UStaticMesh* ASFW_DeviceBase::GetPlacementPreviewMesh() const
+{
+	return DeviceMesh ? DeviceMesh->GetStaticMesh() : nullptr;
+}
+
+// ---------- Power ----------
+
+void ASFW_DeviceBase::SetPowered(bool bEnable)
+{
+	if (!HasAuthority())
+	{
+		Server_SetPowered(bEnable);
+		return;
+	}
+
+	if (Power.bOn == bEnable)
+	{
+		return;
+	}
+
+	FlushNetDormancy();
+	Power.bOn = bEnable;
+	if (!bEnable)
+	{
+		Power.Level = 0;
+	}
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DeviceBase, Power, this);
+
+	RefreshPowerState();
+}
+
+void ASFW_DeviceBase::Server_SetPowered_Implementation(bool bEnable)
+{
+	SetPowered(bEnable);
+}
+
+void ASFW_DeviceBase::SetLevel(int32 NewLevel)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	const uint8 Clamped = static_cast<uint8>(FMath::Clamp(NewLevel, 0, 255));
+	if (Power.Level == Clamped)
+	{
+		return;
+	}
+
+	FlushNetDormancy();
+	Power.Level = Clamped;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DeviceBase, Power, this);
+
+	RefreshPowerState();
+}
+
+void ASFW_DeviceBase::OnRep_Power()
+{
+	RefreshPowerState();
+}
+
+void ASFW_DeviceBase::RefreshPowerState()
+{
+	const bool bFirst = !bPowerApplied;
+	const bool bPowerFlipped = bFirst || AppliedPower.bOn != Power.bOn;
+	const bool bLevelChanged = bFirst || AppliedPower.Level != Power.Level;
+
+	AppliedPower = Power;
+	bPowerApplied = true;
+
+	if (bPowerFlipped)
+	{
+		// No click for the state we spawned / became relevant with
+		if (!bFirst && !bSuppressPowerSFX && IsAudibleTo(PowerSFXAudience))
+		{
+			if (USoundBase* SFX = GetPowerSFX(Power.bOn))
+			{
+				UGameplayStatics::PlaySoundAtLocation(this, SFX, GetActorLocation());
+			}
+		}
+
+		OnPowerChanged(Power.bOn);
+	}
+
+	if (bLevelChanged)
+	{
+		OnLevelChanged(Power.Level);
+	}
+
+	UpdateLoopAudio();
+}
+
+// ---------- Audio ----------
+
+bool ASFW_DeviceBase::IsHeldLocally() const
+{
+	if (IsHidden())
+	{
+		return false;
+	}
+
+	const ACharacter* Holder = Cast<ACharacter>(GetAttachParentActor());
+	return Holder && Holder->IsPlayerControlled() && Holder->IsLocallyControlled();
+}
+
+bool ASFW_DeviceBase::IsAudibleTo(ESFWDeviceAudience Audience) const
+{
+	switch (Audience)
+	{
+	case ESFWDeviceAudience::LocalHolder: return IsHeldLocally();
+	case ESFWDeviceAudience::Everyone:    return !IsHidden();
+	default:                              return false;
+	}
+}
+
+bool ASFW_DeviceBase::ShouldPlayLoop() const
+{
+	return Power.bOn && !IsPooled() && IsAudibleTo(LoopAudience);
+}
+
+void ASFW_DeviceBase::UpdateLoopAudio()
+{
+	if (!LoopAudio || IsRunningDedicatedServer())
+	{
+		return;
+	}
+
+	const bool bPlay = ShouldPlayLoop();
+	if (bPlay && !LoopAudio->IsPlaying())
+	{
+		LoopAudio->Play();
+	}
+	else if (!bPlay && LoopAudio->IsPlaying())
+	{
+		LoopAudio->Stop();
+	}
+}
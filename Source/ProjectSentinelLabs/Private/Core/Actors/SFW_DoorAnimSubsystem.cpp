@@ -0,0 +1,178 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Actors/SFW_DoorAnimSubsystem.h"
+#include "Core/Actors/SFW_DoorBase.h"
+
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+USFW_DoorAnimSubsystem* USFW_DoorAnimSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_DoorAnimSubsystem>() : nullptr;
+}
+
+bool USFW_DoorAnimSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_DoorAnimSubsystem::Deinitialize()
+{
+	while (Doors.Num() > 0)
+	{
+		RemoveAt(Doors.Num() - 1);
+	}
+	Super::Deinitialize();
+}
+
+TStatId USFW_DoorAnimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFW_DoorAnimSubsystem, STATGROUP_Tickables);
+}
+
+float USFW_DoorAnimSubsystem::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GS = World->GetGameState();
+	return GS ? static_cast<float>(GS->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+void USFW_DoorAnimSubsystem::AddDoor(ASFW_DoorBase* Door, float StartTime, float StartYaw, float TargetYaw, float Duration)
+{
+	if (!Door || !Door->Door)
+	{
+		return;
+	}
+
+	int32 Slot = Door->AnimSlot;
+	if (Slot == INDEX_NONE)
+	{
+		Slot = Doors.Add(Door);
+		Leaves.Add(Door->Door);
+		StartTimes.AddDefaulted();
+		StartYaws.AddDefaulted();
+		TargetYaws.AddDefaulted();
+		InvDurations.AddDefaulted();
+		WrittenYaws.AddDefaulted();
+		Door->AnimSlot = Slot;
+	}
+
+	StartTimes[Slot] = StartTime;
+	StartYaws[Slot] = StartYaw;
+	TargetYaws[Slot] = TargetYaw;
+	InvDurations[Slot] = 1.f / FMath::Max(Duration, KINDA_SMALL_NUMBER);
+
+	// Resync on every (re)start: the leaf may have been snapped outside the anim.
+	WrittenYaws[Slot] = Door->Door->GetRelativeRotation().Yaw;
+}
+
+void USFW_DoorAnimSubsystem::RemoveDoor(ASFW_DoorBase* Door)
+{
+	if (Door && Doors.IsValidIndex(Door->AnimSlot))
+	{
+		RemoveAt(Door->AnimSlot);
+	}
+}
+
+void USFW_DoorAnimSubsystem::RemoveAt(int32 Slot)
+{
+	if (ASFW_DoorBase* Door = Doors[Slot].Get())
+	{
+		Door->AnimSlot = INDEX_NONE;
+	}
+
+	Doors.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Leaves.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	StartTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	StartYaws.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	TargetYaws.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	InvDurations.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	WrittenYaws.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	// Whatever was last now lives in Slot.
+	if (Doors.IsValidIndex(Slot))
+	{
+		if (ASFW_DoorBase* Moved = Doors[Slot].Get())
+		{
+			Moved->AnimSlot = Slot;
+		}
+	}
+}
+
+void USFW_DoorAnimSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// ---------- Drop dead doors ----------
+	for (int32 i = Doors.Num() - 1; i >= 0; --i)
+	{
+		if (!Doors[i].IsValid() || !Leaves[i].IsValid())
+		{
+			RemoveAt(i);
+		}
+	}
+
+	const int32 Num = Doors.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	const float Now = GetServerTime();
+
+	// ---------- Evaluate ----------
+	// Alpha first (clamped, so late joiners land on the target), then yaw in place.
+	Scratch.SetNumUninitialized(Num, EAllowShrinking::No);
+	float* Yaws = Scratch.GetData();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		Yaws[i] = FMath::Clamp((Now - StartTimes[i]) * InvDurations[i], 0.f, 1.f);
+	}
+	for (int32 i = 0; i < Num; ++i)
+	{
+		const float Alpha = Yaws[i];
+		Yaws[i] = StartYaws[i] + (TargetYaws[i] - StartYaws[i]) * Alpha;
+		if (Alpha >= 1.f)
+		{
+			Finished.Add(Doors[i]);
+		}
+	}
+
+	// ---------- Write leaves ----------
+	// Only leaves whose yaw moved since our last write; doors waiting on a future
+	// StartTime, or settled on the target, cost nothing past this compare.
+	float* Written = WrittenYaws.GetData();
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (FMath::IsNearlyEqual(Written[i], Yaws[i], 0.01f))
+		{
+			continue;
+		}
+		Written[i] = Yaws[i];
+
+		// Teleport: no sweep, no physics velocity; a swinging leaf shouldn't launch pawns.
+		UStaticMeshComponent* Leaf = Leaves[i].Get();
+		FRotator R = Leaf->GetRelativeRotation();
+		R.Yaw = Yaws[i];
+		Leaf->SetRelativeRotation(R, false, nullptr, ETeleportType::TeleportPhysics);
+	}
+
+	// ---------- Retire ----------
+	// After the write pass: FinishMotion may re-enter AddDoor / RemoveDoor.
+	for (const TWeakObjectPtr<ASFW_DoorBase>& Weak : Finished)
+	{
+		if (ASFW_DoorBase* Door = Weak.Get())
+		{
+			RemoveDoor(Door);
+			Door->FinishMotion();
+		}
+	}
+	Finished.Reset();
+}
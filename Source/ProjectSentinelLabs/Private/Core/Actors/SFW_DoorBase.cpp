@@ -6,17 +6,24 @@
 #include "Components/SphereComponent.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "EngineUtils.h"
 #include "Core/AnomalySystems/SFW_AnomalyDecisionSystem.h"
 #include "Core/Game/SFW_GameState.h"
 #include "Core/AI/Scares/SFW_DoorScareFX.h"
+#include "Core/AI/Scares/SFW_DoorScareFXPoolSubsystem.h"
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Actors/SFW_DoorAnimSubsystem.h"
 
 ASFW_DoorBase::ASFW_DoorBase()
 {
-	PrimaryActorTick.bCanEverTick = true;
-	SetActorTickEnabled(false);
+	// Swings are driven by USFW_DoorAnimSubsystem
+	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
 
+	// Untouched level doors never open a channel; first state change flushes to DormantAll.
+	NetDormancy = DORM_Initial;
+
 	Frame = CreateDefaultSubobject<USceneComponent>(TEXT("Frame"));
 	SetRootComponent(Frame);
 
@@ -55,8 +62,7 @@ void ASFW_DoorBase::BeginPlay()
 		{
 			StartState = (FMath::FRand() < InitialOpenChance) ? EDoorState::Open : EDoorState::Closed;
 		}
-		State = StartState;
-		ApplyState();
+		SetState(StartState);
 
 		for (TActorIterator<ASFW_AnomalyDecisionSystem> It(GetWorld()); It; ++It)
 		{
@@ -75,6 +81,11 @@ void ASFW_DoorBase::BeginPlay()
 
 void ASFW_DoorBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+	if (USFW_DoorAnimSubsystem* Anim = USFW_DoorAnimSubsystem::Get(this))
+	{
+		Anim->RemoveDoor(this);
+	}
+
 	if (HasAuthority())
 	{
 		for (TActorIterator<ASFW_AnomalyDecisionSystem> It(GetWorld()); It; ++It)
@@ -86,21 +97,13 @@ void ASFW_DoorBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void ASFW_DoorBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(ASFW_DoorBase, State);
-	DOREPLIFETIME(ASFW_DoorBase, LockEndTime);
-}
 
-void ASFW_DoorBase::Tick(float DeltaSeconds)
-{
-	Super::Tick(DeltaSeconds);
-	if (State == EDoorState::Opening || State == EDoorState::Closing)
-	{
-		const float Dur = FMath::Max(AnimDuration, KINDA_SMALL_NUMBER);
-		AnimT = FMath::Min(AnimT + (DeltaSeconds / Dur), 1.f);
-		const float NewYaw = FMath::Lerp(StartYaw, TargetYaw, AnimT);
-		SnapTo(NewYaw);
-		if (AnimT >= 1.f) FinishMotion();
-	}
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_DoorBase, State, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_DoorBase, LockEndTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_DoorBase, Motion, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_DoorBase, SlamEvent, Params);
 }
 
 void ASFW_DoorBase::OnRep_State()
@@ -129,34 +132,84 @@ void ASFW_DoorBase::SnapTo(float YawDeg)
 
 void ASFW_DoorBase::ApplyState()
 {
-	const float Current = GetYaw();
+	USFW_DoorAnimSubsystem* Anim = USFW_DoorAnimSubsystem::Get(this);
 	if (State == EDoorState::Opening || State == EDoorState::Closing)
 	{
 		const float Goal = (State == EDoorState::Opening) ? OpenYaw : ClosedYaw;
-		StartYaw = Current;
-		TargetYaw = Goal;
-		AnimT = 0.f;
-		SetActorTickEnabled(true);
+		if (Anim)
+		{
+			// Motion replicates with State, so clients share the server's curve
+			Anim->AddDoor(this, Motion.StartTime, Motion.StartYaw, Goal, AnimDuration);
+		}
+		else
+		{
+			SnapTo(Goal);
+		}
 	}
 	else
 	{
-		SetActorTickEnabled(false);
+		if (Anim)
+		{
+			Anim->RemoveDoor(this);
+		}
 		SnapTo(State == EDoorState::Open ? OpenYaw : ClosedYaw);
 	}
+
+	// Keep the room graph's edge bitset in sync (anything but fully closed counts as open).
+	if (USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(this))
+	{
+		RoomSys->SetDoorOpen(this, State != EDoorState::Closed);
+	}
+}
+
+void ASFW_DoorBase::SetState(EDoorState NewState)
+{
+	if (NewState != State)
+	{
+		FlushNetDormancy();
+		State = NewState;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DoorBase, State, this);
+
+		if (NewState == EDoorState::Opening || NewState == EDoorState::Closing)
+		{
+			const USFW_DoorAnimSubsystem* Anim = USFW_DoorAnimSubsystem::Get(this);
+			Motion.StartTime = Anim ? Anim->GetServerTime() : GetWorld()->GetTimeSeconds();
+			Motion.StartYaw = GetYaw();
+			MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DoorBase, Motion, this);
+		}
+	}
+	ApplyState();
+	UpdateNetDormancy();
+}
+
+void ASFW_DoorBase::UpdateNetDormancy()
+{
+	if (!HasAuthority()) return;
+
+	// Awake while swinging, dormant once settled. A door that never changed keeps DORM_Initial.
+	const bool bMoving = (State == EDoorState::Opening || State == EDoorState::Closing);
+	if (bMoving)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+	else if (NetDormancy == DORM_Awake)
+	{
+		SetNetDormancy(DORM_DormantAll);
+	}
 }
 
 void ASFW_DoorBase::FinishMotion()
 {
-	const bool bToOpen = FMath::IsNearlyEqual(TargetYaw, OpenYaw, 0.5f);
-	if (HasAuthority())
+	// Clients already sit on the target yaw; the settled State arrives by replication.
+	if (!HasAuthority()) return;
+
+	if (State == EDoorState::Opening)
 	{
-		State = bToOpen ? EDoorState::Open : EDoorState::Closed;
-		ApplyState();
+		SetState(EDoorState::Open);
 	}
-	else
+	else if (State == EDoorState::Closing)
 	{
-		SnapTo(bToOpen ? OpenYaw : ClosedYaw);
-		SetActorTickEnabled(false);
+		SetState(EDoorState::Closed);
 	}
 }
 
@@ -173,8 +226,7 @@ void ASFW_DoorBase::OpenDoor()
 	if (State == EDoorState::Open || State == EDoorState::Opening) return;
 	if (!HasAuthority()) return;
 
-	State = EDoorState::Opening;
-	ApplyState();
+	SetState(EDoorState::Opening);
 }
 
 void ASFW_DoorBase::CloseDoor()
@@ -189,8 +241,7 @@ void ASFW_DoorBase::CloseDoor()
 	if (State == EDoorState::Closed || State == EDoorState::Closing) return;
 	if (!HasAuthority()) return;
 
-	State = EDoorState::Closing;
-	ApplyState();
+	SetState(EDoorState::Closing);
 }
 
 
@@ -198,15 +249,18 @@ void ASFW_DoorBase::LockDoor(float Duration)
 {
 	if (!HasAuthority()) return;
 	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	FlushNetDormancy();
 	LockEndTime = Now + FMath::Max(Duration, 0.f);
-	State = EDoorState::Closing;
-	ApplyState();
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DoorBase, LockEndTime, this);
+	SetState(EDoorState::Closing);
 }
 
 void ASFW_DoorBase::Unlock()
 {
 	if (!HasAuthority()) return;
+	FlushNetDormancy();
 	LockEndTime = 0.f;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DoorBase, LockEndTime, this);
 }
 
 // --- Scare logic ---
@@ -244,8 +298,13 @@ void ASFW_DoorBase::TryDoorScare(APawn* Pawn, bool bForce)
 
 void ASFW_DoorBase::StartSlamSequence(APawn* /*Pawn*/)
 {
+	// Stay awake through the slam; FinishMotion puts the door back to sleep.
+	SetNetDormancy(DORM_Awake);
+
 	const FTransform Where = ComputeScareFXTransform();
-	Multicast_PlaySlamFX(Where);
+	SlamEvent.Fire(this, 1, Where.GetLocation(), Where.Rotator().Euler());
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_DoorBase, SlamEvent, this);
+	OnRep_SlamEvent();
 
 	// time the actual door slam to match the animation beat
 	GetWorldTimerManager().SetTimer(Timer_SlamImpact, this, &ASFW_DoorBase::OnSlamImpact, SlamImpactDelay, false);
@@ -255,11 +314,8 @@ void ASFW_DoorBase::OnSlamImpact()
 {
 	if (!HasAuthority()) return;
 
-	const FVector Loc = Door ? Door->GetComponentLocation() : GetActorLocation();
-	Multicast_PlaySlamSFX(Loc);
-
-	State = EDoorState::Closing;
-	ApplyState();
+	// SFX is timed locally from SlamEvent on every machine
+	SetState(EDoorState::Closing);
 	LockDoor(ScareLockDuration);
 }
 
@@ -277,29 +333,46 @@ FTransform ASFW_DoorBase::ComputeScareFXTransform() const
 	return FTransform(WorldRot, WorldLoc, FVector(1.f));
 }
 
-void ASFW_DoorBase::Multicast_PlaySlamFX_Implementation(const FTransform& Where)
+void ASFW_DoorBase::OnRep_SlamEvent()
 {
-	if (!ScareFXClass) return;
+	// Late joiners / doors becoming relevant mid-scare skip it; a scare is all about the beat
+	if (SlamReceiver.Receive(this, SlamEvent, SlamImpactDelay + 0.5f) != ESFWCosmeticEventReceipt::Play)
+	{
+		return;
+	}
+
+	if (IsRunningDedicatedServer()) return;
 
-	ASFW_DoorScareFX* FX = GetWorld()->SpawnActorDeferred<ASFW_DoorScareFX>(
-		ScareFXClass, Where, this, nullptr, ESpawnActorCollisionHandlingMethod::AlwaysSpawn);
+	PlaySlamFX(FTransform(FRotator::MakeFromEuler(SlamEvent.Payload), SlamEvent.Location));
 
-	if (FX)
+	// Impact lands SlamImpactDelay after the server fired, however late this arrived
+	const float Remaining = SlamImpactDelay - FSFWCosmeticEventReceiver::GetAge(this, SlamEvent);
+	if (Remaining > KINDA_SMALL_NUMBER)
 	{
-		FX->Lifetime = ScareFXLifetime; // Blueprint subclass anim can auto-play
-		FX->FinishSpawning(Where);
+		GetWorldTimerManager().SetTimer(Timer_SlamSFX, this, &ASFW_DoorBase::PlaySlamSFX, Remaining, false);
+	}
+	else
+	{
+		PlaySlamSFX();
+	}
+}
 
-		if (bAttachFXToAnchor && ScareFXAnchor)
-		{
-			FX->AttachToComponent(ScareFXAnchor, FAttachmentTransformRules::KeepWorldTransform);
-		}
+void ASFW_DoorBase::PlaySlamFX(const FTransform& Where)
+{
+	if (!ScareFXClass) return;
+
+	// Pooled and pre-spawned so the slam lands on the beat; no pool on dedicated servers
+	if (USFW_DoorScareFXPoolSubsystem* Pool = USFW_DoorScareFXPoolSubsystem::Get(this))
+	{
+		Pool->Play(ScareFXClass, Where, ScareFXLifetime, (bAttachFXToAnchor && ScareFXAnchor) ? ScareFXAnchor : nullptr);
 	}
 }
 
-void ASFW_DoorBase::Multicast_PlaySlamSFX_Implementation(const FVector& Loc)
+void ASFW_DoorBase::PlaySlamSFX()
 {
 	if (SlamSFX)
 	{
+		const FVector Loc = Door ? Door->GetComponentLocation() : GetActorLocation();
 		UGameplayStatics::PlaySoundAtLocation(this, SlamSFX, Loc);
 	}
 }
@@ -5,13 +5,8 @@
 #include "Core/Actors/SFW_EMFDevice.h"
 
 #include "Components/StaticMeshComponent.h"
-#include "Components/AudioComponent.h"
-#include "Components/SkeletalMeshComponent.h"
-#include "Components/PrimitiveComponent.h"
 #include "GameFramework/Character.h"
-#include "Kismet/GameplayStatics.h"
 #include "Materials/MaterialInstanceDynamic.h"
-#include "Net/UnrealNetwork.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
 #include "EngineUtils.h"
@@ -20,44 +15,16 @@
 
 ASFW_EMFDevice::ASFW_EMFDevice()
 {
-	PrimaryActorTick.bCanEverTick = false;
-	bReplicates = true;
-	bNetUseOwnerRelevancy = true;
-
-	// Root skeletal mesh comes from ASFW_EquippableBase (Mesh)
-
-	EMFMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("EMFMesh"));
-	EMFMesh->SetupAttachment(GetRootComponent());
-	EMFMesh->SetIsReplicated(true);
-
-	// Let BP / defaults drive collision when in the world.
-	// Do NOT force NoCollision here.
-	// e.g. in BP set:
-	//   CollisionEnabled = QueryAndPhysics
-	//   Visibility = Block
-	//   WorldStatic/WorldDynamic = Block
-
-	HumAudioComp = CreateDefaultSubobject<UAudioComponent>(TEXT("HumAudioComp"));
-	HumAudioComp->SetupAttachment(EMFMesh);
-	HumAudioComp->bAutoActivate = false;
+	CreateDeviceComponents(TEXT("EMFMesh"), TEXT("HumAudioComp"));
 
+	// Let BP / defaults drive DeviceMesh collision when in the world.
 	// Do not hide or disable collision here; that breaks level-placed pickups.
 	// State transitions are handled in OnEquipped / OnDropped.
-	// SetActorHiddenInGame(false);
-	// SetActorEnableCollision(true);
 
-	bIsActive = false;
-	EMFLevel = 0;
 	BurstLevel = 0;
 	BurstEndTime = 0.f;
 }
 
-UPrimitiveComponent* ASFW_EMFDevice::GetPhysicsComponent() const
-{
-	// Use the static mesh body for drop physics
-	return EMFMesh;
-}
-
 void ASFW_EMFDevice::BeginPlay()
 {
 	Super::BeginPlay();
@@ -65,19 +32,10 @@ void ASFW_EMFDevice::BeginPlay()
 	// Build LED dynamic MIDs on all instances (server and clients)
 	CacheLEDMaterials();
 
-	// Sync visuals/audio to initial replicated state
-	ApplyActiveState();
+	// Super applied the initial power state before the LEDs existed
 	UpdateLEDVisuals();
 }
 
-void ASFW_EMFDevice::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
-{
-	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-
-	DOREPLIFETIME(ASFW_EMFDevice, bIsActive);
-	DOREPLIFETIME(ASFW_EMFDevice, EMFLevel);
-}
-
 void ASFW_EMFDevice::OnEquipped(ACharacter* NewOwnerChar)
 {
 	Super::OnEquipped(NewOwnerChar);  // attaches to socket, turns physics off, restores transform
@@ -85,56 +43,15 @@ void ASFW_EMFDevice::OnEquipped(ACharacter* NewOwnerChar)
 	UE_LOG(LogTemp, Log, TEXT("[EMF] OnEquipped called. OwnerChar=%s"),
 		NewOwnerChar ? *NewOwnerChar->GetName() : TEXT("NULL"));
 
-	if (EMFMesh)
-	{
-		EMFMesh->SetVisibility(true, true);
-	}
-
 	// Ensure LEDs are cached if BeginPlay ran pre-attachment
 	if (LEDMIDs.Num() == 0)
 	{
 		CacheLEDMaterials();
 	}
 
-	ApplyActiveState();
 	UpdateLEDVisuals();
 }
 
-
-void ASFW_EMFDevice::OnUnequipped()
-{
-	// Hide visuals while stored but not dropped
-	if (EMFMesh)
-	{
-		EMFMesh->SetVisibility(false, true);
-	}
-
-	if (HumAudioComp && HumAudioComp->IsPlaying())
-	{
-		HumAudioComp->Stop();
-	}
-
-	Super::OnUnequipped();
-}
-
-void ASFW_EMFDevice::OnDropped(const FVector& DropLocation, const FVector& TossVelocity)
-{
-	// Base handles physics / collision via GetPhysicsComponent (EMFMesh)
-	Super::OnDropped(DropLocation, TossVelocity);
-
-	// Dropped into the world should be visible
-	if (EMFMesh)
-	{
-		EMFMesh->SetVisibility(true, true);
-	}
-
-	// Optional: no hum while dropped
-	if (HumAudioComp && HumAudioComp->IsPlaying())
-	{
-		HumAudioComp->Stop();
-	}
-}
-
 void ASFW_EMFDevice::PrimaryUse()
 {
 	ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
@@ -145,7 +62,7 @@ void ASFW_EMFDevice::PrimaryUse()
 
 	UE_LOG(LogTemp, Log, TEXT("[EMF] PrimaryUse by %s on client (LocallyControlled=1)"), *GetName());
 
-	Server_RequestToggle();
+	TogglePower();
 }
 
 EHeldItemType ASFW_EMFDevice::GetAnimHeldType_Implementation() const
@@ -153,108 +70,14 @@ EHeldItemType ASFW_EMFDevice::GetAnimHeldType_Implementation() const
 	return EHeldItemType::EMF;
 }
 
-void ASFW_EMFDevice::Server_RequestToggle_Implementation()
+void ASFW_EMFDevice::OnPowerChanged(bool bOn)
 {
-	UE_LOG(LogTemp, Log, TEXT("[EMF] Server_RequestToggle_Implementation. Pre bIsActive=%d"), bIsActive ? 1 : 0);
+	UE_LOG(LogTemp, Log, TEXT("[EMF] OnPowerChanged -> %d"), bOn ? 1 : 0);
 
-	SetActive(!bIsActive);
-
-	UE_LOG(LogTemp, Log, TEXT("[EMF] Server_RequestToggle_Implementation. Post bIsActive=%d"), bIsActive ? 1 : 0);
-}
-
-void ASFW_EMFDevice::SetActive(bool bEnable)
-{
-	if (!HasAuthority())
-	{
-		Server_SetActive(bEnable);
-		return;
-	}
-
-	bIsActive = bEnable;
-
-	UE_LOG(LogTemp, Log, TEXT("[EMF] SetActive AUTH. Now bIsActive=%d"), bIsActive ? 1 : 0);
-
-	ApplyActiveState();
-	UpdateLEDVisuals();
-}
-
-void ASFW_EMFDevice::Server_SetActive_Implementation(bool bEnable)
-{
-	bIsActive = bEnable;
-
-	UE_LOG(LogTemp, Log, TEXT("[EMF] Server_SetActive_Implementation. Now bIsActive=%d"), bIsActive ? 1 : 0);
-
-	ApplyActiveState();
-	UpdateLEDVisuals();
-}
-
-void ASFW_EMFDevice::OnRep_IsActive()
-{
-	UE_LOG(LogTemp, Log, TEXT("[EMF] OnRep_IsActive -> %d"), bIsActive ? 1 : 0);
-
-	ApplyActiveState();
-	UpdateLEDVisuals();
-}
-
-void ASFW_EMFDevice::Server_SetEMFLevel_Implementation(int32 NewLevel)
-{
-	EMFLevel = FMath::Clamp(NewLevel, 0, 5);
-	UpdateLEDVisuals();
-}
-
-void ASFW_EMFDevice::OnRep_EMFLevel()
-{
-	UpdateLEDVisuals();
-}
-
-void ASFW_EMFDevice::ApplyActiveState()
-{
-	// 1. Hum / power SFX are for local owner only
-	ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
-	const bool bLocalOwner =
-		OwnerChar &&
-		OwnerChar->IsPlayerControlled() &&
-		OwnerChar->IsLocallyControlled();
-
-	if (HumAudioComp)
-	{
-		if (bIsActive)
-		{
-			if (bLocalOwner && !HumAudioComp->IsPlaying())
-			{
-				HumAudioComp->Play();
-			}
-
-			if (!bLocalOwner && HumAudioComp->IsPlaying())
-			{
-				HumAudioComp->Stop();
-			}
-		}
-		else
-		{
-			if (HumAudioComp->IsPlaying())
-			{
-				HumAudioComp->Stop();
-			}
-		}
-	}
-
-	if (bLocalOwner)
-	{
-		if (bIsActive && PowerOnSFX)
-		{
-			UGameplayStatics::PlaySoundAtLocation(this, PowerOnSFX, GetActorLocation());
-		}
-		else if (!bIsActive && PowerOffSFX)
-		{
-			UGameplayStatics::PlaySoundAtLocation(this, PowerOffSFX, GetActorLocation());
-		}
-	}
-
-	// 2. Server scan timer mirrors sources + bursts into our replicated EMFLevel
+	// Server scan timer mirrors sources + bursts into our replicated level
 	if (HasAuthority())
 	{
-		if (bIsActive)
+		if (bOn)
 		{
 			if (!GetWorldTimerManager().IsTimerActive(ScanTimerHandle))
 			{
@@ -274,9 +97,15 @@ void ASFW_EMFDevice::ApplyActiveState()
 
 			BurstLevel = 0;
 			BurstEndTime = 0.f;
-			Server_SetEMFLevel(0);
 		}
 	}
+
+	UpdateLEDVisuals();
+}
+
+void ASFW_EMFDevice::OnLevelChanged(int32 NewLevel)
+{
+	UpdateLEDVisuals();
 }
 
 void ASFW_EMFDevice::TriggerAnomalyBurst(int32 Level, float Seconds)
@@ -311,7 +140,7 @@ void ASFW_EMFDevice::TriggerAnomalyBurst(int32 Level, float Seconds)
 void ASFW_EMFDevice::DoServerScanForEMF()
 {
 	if (!HasAuthority()) return;
-	if (!bIsActive) return;
+	if (!IsPowered()) return;
 
 	ACharacter* OwnerChar = Cast<ACharacter>(GetOwner());
 	const FVector Origin = OwnerChar ? OwnerChar->GetActorLocation() : GetActorLocation();
@@ -379,17 +208,15 @@ void ASFW_EMFDevice::DoServerScanForEMF()
 		}
 	}
 
-	if (NewLevel != EMFLevel)
-	{
-		Server_SetEMFLevel(NewLevel);
-	}
+	const int32 OldLevel = GetEMFLevel();
+	SetEMFLevel(NewLevel);
 
 	UE_LOG(
 		LogTemp,
 		Log,
 		TEXT("[EMF] DoServerScanForEMF tick. bIsActive=%d EMFLevel=%d New=%d BurstLevel=%d BurstTime=%.2f"),
-		bIsActive ? 1 : 0,
-		EMFLevel,
+		IsPowered() ? 1 : 0,
+		OldLevel,
 		NewLevel,
 		BurstLevel,
 		BurstTimeRemaining
@@ -436,7 +263,8 @@ void ASFW_EMFDevice::CacheLEDMaterials()
 
 void ASFW_EMFDevice::UpdateLEDVisuals()
 {
-	const int32 VisibleLevel = bIsActive ? EMFLevel : 0;
+	const bool bIsActive = IsPowered();
+	const int32 VisibleLevel = bIsActive ? GetEMFLevel() : 0;
 
 	for (int32 i = 0; i < LEDMIDs.Num(); ++i)
 	{
@@ -6,8 +6,16 @@
 #include "GameFramework/Character.h"
 #include "GameFramework/Controller.h"
 #include "Core/Components/SFW_EquipmentManagerComponent.h"
-
-ASFW_EquippableBase::ASFW_EquippableBase()
+#include "Core/Actors/Data/SFW_HandHeldItemDataAsset.h"
+#include "Core/Actors/Data/SFW_ItemAssetSubsystem.h"
+#include "Core/Net/SFW_ReplicationGraph.h"
+#include "Engine/TextureLightProfile.h"
+#include "Sound/SoundBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+
+ASFW_EquippableBase::ASFW_EquippableBase(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
 {
 	PrimaryActorTick.bCanEverTick = false;
 	bReplicates = true;
@@ -15,13 +23,20 @@ ASFW_EquippableBase::ASFW_EquippableBase()
 
 	SetReplicateMovement(true);
 
-	Mesh = CreateDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh"));
-	SetRootComponent(Mesh);
-	Mesh->SetIsReplicated(true);
-	Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	Mesh = CreateOptionalDefaultSubobject<USkeletalMeshComponent>(TEXT("Mesh"));
+	if (Mesh)
+	{
+		SetRootComponent(Mesh);
+		Mesh->SetIsReplicated(true);
+		Mesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
 
+	// Subclasses that skip Mesh attach this under their own root
 	InteractionCollision = CreateDefaultSubobject<UBoxComponent>(TEXT("InteractionCollision"));
-	InteractionCollision->SetupAttachment(RootComponent);
+	if (RootComponent)
+	{
+		InteractionCollision->SetupAttachment(RootComponent);
+	}
 	InteractionCollision->SetBoxExtent(FVector(10.f));
 
 	InteractionCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
@@ -37,7 +52,71 @@ void ASFW_EquippableBase::BeginPlay()
 	{
 		InitialPhysicsRelativeTransform = Phys->GetRelativeTransform();
 		bHasCachedPhysicsRelativeTransform = true;
+
+		if (HasAuthority())
+		{
+			// Dropped items go dormant once their rigid body sleeps
+			Phys->SetGenerateWakeEvents(true);
+			Phys->OnComponentSleep.AddDynamic(this, &ASFW_EquippableBase::HandlePhysicsSleep);
+		}
+	}
+
+	// Items placed in the level start on the floor
+	SettleNetDormancy();
+
+	UpdatePresentationAssets();
+}
+
+void ASFW_EquippableBase::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_EquippableBase, WorldEvent, Params);
+}
+
+void ASFW_EquippableBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bPresentationRetained)
+	{
+		if (USFW_ItemAssetSubsystem* Assets = USFW_ItemAssetSubsystem::Get(this))
+		{
+			Assets->Release(ItemData);
+			Assets->Release(GetClass());
+		}
+		bPresentationRetained = false;
 	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASFW_EquippableBase::SetOwner(AActor* NewOwner)
+{
+	Super::SetOwner(NewOwner);
+	UpdatePresentationAssets();
+
+	if (HasAuthority())
+	{
+		USFW_ReplicationGraph::NotifyOwnerRoutingChanged(this);
+	}
+}
+
+void ASFW_EquippableBase::SetActorHiddenInGame(bool bNewHidden)
+{
+	const bool bChanged = IsHidden() != bNewHidden;
+	Super::SetActorHiddenInGame(bNewHidden);
+
+	if (bChanged && HasAuthority())
+	{
+		USFW_ReplicationGraph::NotifyOwnerRoutingChanged(this);
+	}
+}
+
+void ASFW_EquippableBase::OnRep_Owner()
+{
+	Super::OnRep_Owner();
+	UpdatePresentationAssets();
 }
 
 // ---------- Equip / Unequip / Drop ----------
@@ -49,27 +128,32 @@ void ASFW_EquippableBase::OnEquipped(ACharacter* NewOwnerChar)
 		SetOwner(NewOwnerChar);
 	}
 
-	AttachToCharacter(NewOwnerChar, GetAttachSocketName());
+	ClearWorldEvent();
 
+	// Physics off first: a simulating root body would fight the socket attach
 	if (UPrimitiveComponent* Phys = GetPhysicsComponent())
 	{
 		Phys->SetSimulatePhysics(false);
 		Phys->SetEnableGravity(false);
 		Phys->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 
-		if (bHasCachedPhysicsRelativeTransform)
+		// A root body snaps to the socket below; only child bodies need putting back
+		if (bHasCachedPhysicsRelativeTransform && Phys != GetRootComponent())
 		{
-			if (Phys != GetRootComponent())
-			{
-				Phys->AttachToComponent(
-					GetRootComponent(),
-					FAttachmentTransformRules::KeepRelativeTransform);
-			}
+			Phys->AttachToComponent(
+				GetRootComponent(),
+				FAttachmentTransformRules::KeepRelativeTransform);
 
 			Phys->SetRelativeTransform(InitialPhysicsRelativeTransform);
 		}
 	}
 
+	// Stowed items are already on the socket
+	if (GetAttachParentActor() != NewOwnerChar)
+	{
+		AttachToCharacter(NewOwnerChar, GetAttachSocketName());
+	}
+
 	if (InteractionCollision)
 	{
 		InteractionCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
@@ -88,7 +172,15 @@ void ASFW_EquippableBase::OnUnequipped()
 		InteractionCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
 	}
 
-	DetachFromCharacter();
+	// Stay on the carrier while stowed, so the next equip is just a visibility flip.
+	// Drop / place detach explicitly.
+	if (ACharacter* Carrier = Cast<ACharacter>(GetOwner()))
+	{
+		if (GetAttachParentActor() != Carrier)
+		{
+			AttachToCharacter(Carrier, GetAttachSocketName());
+		}
+	}
 }
 
 void ASFW_EquippableBase::OnDropped(const FVector& DropLocation, const FVector& TossVelocity)
@@ -123,9 +215,15 @@ void ASFW_EquippableBase::OnDropped(const FVector& DropLocation, const FVector&
 	}
 }
 
-void ASFW_EquippableBase::Multicast_OnDropped_Implementation(const FVector& DropLocation, const FVector& TossVelocity)
+void ASFW_EquippableBase::NotifyDropped(const FVector& DropLocation, const FVector& TossVelocity)
 {
-	OnDropped(DropLocation, TossVelocity);
+	if (!HasAuthority()) return;
+
+	FlushNetDormancy();
+	WorldEvent.Fire(this, static_cast<uint8>(EWorldEventType::Dropped), DropLocation, TossVelocity);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_EquippableBase, WorldEvent, this);
+
+	OnRep_WorldEvent();
 }
 
 // ---------- Placement ----------
@@ -160,11 +258,212 @@ void ASFW_EquippableBase::OnPlaced(const FTransform& WorldTransform)
 	{
 		InteractionCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
 	}
+
+	// Placed devices are static; only their own state changes wake them.
+	SettleNetDormancy();
+}
+
+void ASFW_EquippableBase::NotifyPlaced(const FTransform& WorldTransform)
+{
+	if (!HasAuthority()) return;
+
+	FlushNetDormancy();
+	WorldEvent.Fire(this, static_cast<uint8>(EWorldEventType::Placed), WorldTransform.GetLocation(), WorldTransform.Rotator().Euler());
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_EquippableBase, WorldEvent, this);
+
+	OnRep_WorldEvent();
+}
+
+// ---------- World event ----------
+
+void ASFW_EquippableBase::OnRep_WorldEvent()
+{
+	const ESFWCosmeticEventReceipt Receipt = WorldEventReceiver.Receive(this, WorldEvent, 1.f);
+	if (Receipt == ESFWCosmeticEventReceipt::None)
+	{
+		return;
+	}
+
+	const bool bFresh = (Receipt == ESFWCosmeticEventReceipt::Play);
+
+	// Old news (late join / re-relevant): only settle items still lying in the world, no toss
+	if (!bFresh && (GetAttachParentActor() || IsHidden()))
+	{
+		return;
+	}
+
+	switch (static_cast<EWorldEventType>(WorldEvent.Type))
+	{
+	case EWorldEventType::Dropped:
+		OnDropped(bFresh ? FVector(WorldEvent.Location) : GetActorLocation(), bFresh ? FVector(WorldEvent.Payload) : FVector::ZeroVector);
+		break;
+
+	case EWorldEventType::Placed:
+		OnPlaced(FTransform(FRotator::MakeFromEuler(WorldEvent.Payload), WorldEvent.Location));
+		break;
+
+	default:
+		break;
+	}
+}
+
+void ASFW_EquippableBase::ClearWorldEvent()
+{
+	if (!HasAuthority() || WorldEvent.Type == static_cast<uint8>(EWorldEventType::None))
+	{
+		return;
+	}
+
+	// No Counter bump: clients just stop treating the last drop / place as current
+	FlushNetDormancy();
+	WorldEvent.Type = static_cast<uint8>(EWorldEventType::None);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_EquippableBase, WorldEvent, this);
+}
+
+// ---------- Pooling ----------
+
+void ASFW_EquippableBase::OnAcquiredFromPool()
+{
+	bPooled = false;
+
+	SetNetDormancy(DORM_Awake);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+
+	if (InteractionCollision)
+	{
+		InteractionCollision->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	}
+}
+
+void ASFW_EquippableBase::OnReturnedToPool()
+{
+	bPooled = true;
+
+	FlushNetDormancy();
+	ClearWorldEvent();
+	DetachFromCharacter();
+	SetOwner(nullptr);
+	SetInstigator(nullptr);
+
+	if (UPrimitiveComponent* Phys = GetPhysicsComponent())
+	{
+		Phys->SetSimulatePhysics(false);
+		Phys->SetEnableGravity(false);
+		Phys->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+
+		// Dropped bodies detach from the root; put them back for the next equip
+		if (bHasCachedPhysicsRelativeTransform && Phys != GetRootComponent())
+		{
+			Phys->AttachToComponent(GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+			Phys->SetRelativeTransform(InitialPhysicsRelativeTransform);
+		}
+	}
+
+	if (InteractionCollision)
+	{
+		InteractionCollision->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+
+	SetNetDormancy(DORM_DormantAll);
+}
+
+// ---------- Net dormancy ----------
+
+void ASFW_EquippableBase::SettleNetDormancy()
+{
+	if (!HasAuthority() || bPooled || GetAttachParentActor())
+	{
+		return;
+	}
+
+	const UPrimitiveComponent* Phys = GetPhysicsComponent();
+	if (Phys && Phys->IsSimulatingPhysics() && Phys->RigidBodyIsAwake())
+	{
+		return; // wait for HandlePhysicsSleep
+	}
+
+	SetNetDormancy(DORM_DormantAll);
+}
+
+void ASFW_EquippableBase::HandlePhysicsSleep(UPrimitiveComponent* SleepingComponent, FName BoneName)
+{
+	SettleNetDormancy();
+}
+
+// ---------- Presentation assets ----------
+
+void ASFW_EquippableBase::UpdatePresentationAssets()
+{
+	if (!HasActorBegunPlay())
+	{
+		return;
+	}
+
+	USFW_ItemAssetSubsystem* Assets = USFW_ItemAssetSubsystem::Get(this);
+	if (!Assets)
+	{
+		return; // dedicated server
+	}
+
+	const bool bWant = Cast<APawn>(GetOwner()) != nullptr;
+	if (bWant == bPresentationRetained)
+	{
+		return;
+	}
+
+	bPresentationRetained = bWant;
+	if (bWant)
+	{
+		Assets->Retain(ItemData, FSimpleDelegate::CreateUObject(this, &ASFW_EquippableBase::OnPresentationAssetsLoaded));
+
+		// Fallbacks are EditDefaultsOnly, so every instance of a class shares one holder key
+		TArray<FSoftObjectPath> Fallbacks;
+		GetFallbackPresentationAssets(Fallbacks);
+		if (Fallbacks.Num() > 0)
+		{
+			Assets->Retain(GetClass(), MoveTemp(Fallbacks), FSimpleDelegate::CreateUObject(this, &ASFW_EquippableBase::OnPresentationAssetsLoaded));
+		}
+	}
+	else
+	{
+		Assets->Release(ItemData);
+		Assets->Release(GetClass());
+	}
+}
+
+void ASFW_EquippableBase::GetFallbackPresentationAssets(TArray<FSoftObjectPath>& OutPaths) const
+{
+	for (const FSoftObjectPath& Path : { PowerOnSFX.ToSoftObjectPath(), PowerOffSFX.ToSoftObjectPath(), UseSFX.ToSoftObjectPath(), IESProfile.ToSoftObjectPath() })
+	{
+		if (!Path.IsNull())
+		{
+			OutPaths.AddUnique(Path);
+		}
+	}
+}
+
+UTextureLightProfile* ASFW_EquippableBase::GetIESProfile() const
+{
+	return (ItemData && !ItemData->IESProfile.IsNull()) ? ItemData->IESProfile.Get() : IESProfile.Get();
+}
+
+USoundBase* ASFW_EquippableBase::GetPowerSFX(bool bOn) const
+{
+	const TSoftObjectPtr<USoundBase>* Soft = ItemData ? (bOn ? &ItemData->PowerOnSFX : &ItemData->PowerOffSFX) : nullptr;
+	if (!Soft || Soft->IsNull())
+	{
+		Soft = bOn ? &PowerOnSFX : &PowerOffSFX;
+	}
+	return Soft->Get();
 }
 
-void ASFW_EquippableBase::Multicast_OnPlaced_Implementation(const FTransform& WorldTransform)
+USoundBase* ASFW_EquippableBase::GetUseSFX() const
 {
-	OnPlaced(WorldTransform);
+	return (ItemData && !ItemData->UseSFX.IsNull()) ? ItemData->UseSFX.Get() : UseSFX.Get();
 }
 
 // ---------- Attach / Helpers ----------
@@ -223,7 +522,7 @@ void ASFW_EquippableBase::Interact_Implementation(AController* InstigatorControl
 		*GetName(),
 		HasAuthority() ? 1 : 0);
 
-	if (!InstigatorController)
+	if (!InstigatorController || bPooled)
 	{
 		return;
 	}
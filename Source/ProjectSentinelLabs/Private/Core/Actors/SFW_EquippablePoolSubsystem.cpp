@@ -0,0 +1,190 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Actors/SFW_EquippablePoolSubsystem.h"
+#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_WorldPickup.h"
+#include "Core/Components/SFW_EquipmentManagerComponent.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
+
+USFW_EquippablePoolSubsystem* USFW_EquippablePoolSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_EquippablePoolSubsystem>() : nullptr;
+}
+
+bool USFW_EquippablePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_EquippablePoolSubsystem::Deinitialize()
+{
+	// Actors go down with the world
+	Buckets.Reset();
+	Outstanding.Reset();
+	Super::Deinitialize();
+}
+
+bool USFW_EquippablePoolSubsystem::CanPool() const
+{
+	const UWorld* World = GetWorld();
+	return World && World->GetNetMode() != NM_Client;
+}
+
+ASFW_EquippableBase* USFW_EquippablePoolSubsystem::SpawnPooled(UClass* Class, const FTransform& Transform)
+{
+	FActorSpawnParameters Params;
+	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	Params.ObjectFlags |= RF_Transient;
+
+	return GetWorld()->SpawnActor<ASFW_EquippableBase>(Class, Transform, Params);
+}
+
+void USFW_EquippablePoolSubsystem::Prewarm(TSubclassOf<ASFW_EquippableBase> Class, int32 Count)
+{
+	if (!Class || Count <= 0 || !CanPool())
+	{
+		return;
+	}
+
+	FSFWEquippablePoolBucket& Bucket = Buckets.FindOrAdd(Class.Get());
+	Bucket.Free.Reserve(Count);
+
+	while (Bucket.Free.Num() < Count)
+	{
+		ASFW_EquippableBase* Item = SpawnPooled(Class, FTransform::Identity);
+		if (!Item)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[EquipPool] Failed to prewarm %s"), *GetNameSafe(Class));
+			return;
+		}
+
+		Item->OnReturnedToPool();
+		Bucket.Free.Add(Item);
+	}
+}
+
+void USFW_EquippablePoolSubsystem::PrewarmFromWorldPickups()
+{
+	if (!CanPool())
+	{
+		return;
+	}
+
+	TMap<UClass*, int32> Loadout;
+	for (TActorIterator<ASFW_WorldPickup> It(GetWorld()); It; ++It)
+	{
+		if (UClass* ItemClass = It->GetItemClass())
+		{
+			++Loadout.FindOrAdd(ItemClass);
+		}
+	}
+
+	for (const TPair<UClass*, int32>& Entry : Loadout)
+	{
+		Prewarm(Entry.Key, Entry.Value);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[EquipPool] Prewarmed %d item classes from world pickups"), Loadout.Num());
+}
+
+ASFW_EquippableBase* USFW_EquippablePoolSubsystem::Acquire(TSubclassOf<ASFW_EquippableBase> Class, const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator)
+{
+	if (!Class || !CanPool())
+	{
+		return nullptr;
+	}
+
+	ASFW_EquippableBase* Item = nullptr;
+
+	if (FSFWEquippablePoolBucket* Bucket = Buckets.Find(Class.Get()))
+	{
+		while (!Item && Bucket->Free.Num() > 0)
+		{
+			Item = Bucket->Free.Pop(EAllowShrinking::No);
+			if (!IsValid(Item))
+			{
+				Item = nullptr;
+			}
+		}
+	}
+
+	if (Item)
+	{
+		Item->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[EquipPool] %s bucket empty, spawning"), *GetNameSafe(Class));
+		Item = SpawnPooled(Class, Transform);
+		if (!Item)
+		{
+			return nullptr;
+		}
+	}
+
+	Item->SetOwner(NewOwner);
+	Item->SetInstigator(NewInstigator);
+	Item->OnAcquiredFromPool();
+
+	Outstanding.Add(Item);
+	return Item;
+}
+
+void USFW_EquippablePoolSubsystem::Release(ASFW_EquippableBase* Item)
+{
+	if (!IsValid(Item) || Item->IsPooled() || !CanPool())
+	{
+		return;
+	}
+
+	Item->OnReturnedToPool();
+	Buckets.FindOrAdd(Item->GetClass()).Free.Add(Item);
+	Outstanding.RemoveSwap(Item, EAllowShrinking::No);
+}
+
+void USFW_EquippablePoolSubsystem::ReleaseAll()
+{
+	if (!CanPool())
+	{
+		return;
+	}
+
+	// ---------- Carried gear ----------
+	TArray<ASFW_EquippableBase*> Carried;
+	if (const AGameStateBase* GS = GetWorld()->GetGameState())
+	{
+		for (APlayerState* PS : GS->PlayerArray)
+		{
+			const APawn* Pawn = PS ? PS->GetPawn() : nullptr;
+			if (USFW_EquipmentManagerComponent* Equip = Pawn ? Pawn->FindComponentByClass<USFW_EquipmentManagerComponent>() : nullptr)
+			{
+				Equip->RemoveAllItems(Carried);
+			}
+		}
+	}
+
+	for (ASFW_EquippableBase* Item : Carried)
+	{
+		Release(Item);
+	}
+
+	// ---------- Dropped / placed gear ----------
+	const TArray<TWeakObjectPtr<ASFW_EquippableBase>> Remaining = Outstanding;
+	for (const TWeakObjectPtr<ASFW_EquippableBase>& Item : Remaining)
+	{
+		Release(Item.Get());
+	}
+	Outstanding.Reset();
+}
+
+int32 USFW_EquippablePoolSubsystem::GetNumFree(TSubclassOf<ASFW_EquippableBase> Class) const
+{
+	const FSFWEquippablePoolBucket* Bucket = Buckets.Find(Class.Get());
+	return Bucket ? Bucket->Free.Num() : 0;
+}
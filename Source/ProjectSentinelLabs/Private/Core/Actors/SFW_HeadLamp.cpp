@@ -10,6 +10,7 @@
 #include "GameFramework/Controller.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 #include "Core/Components/SFW_EquipmentManagerComponent.h"
 
@@ -48,13 +49,8 @@ ASFW_HeadLamp::ASFW_HeadLamp()
 	Lamp->SetOuterConeAngle(OuterCone);
 	Lamp->SetIntensity(0.f);
 	Lamp->SetVisibility(false);
-
-	if (IESProfile)
-	{
-		Lamp->SetIESTexture(IESProfile);
-		Lamp->bUseIESBrightness = bUseIESBrightness;
-		Lamp->IESBrightnessScale = IESBrightnessScale;
-	}
+	Lamp->bUseIESBrightness = bUseIESBrightness;
+	Lamp->IESBrightnessScale = IESBrightnessScale;
 
 	SetActorHiddenInGame(true);
 	SetActorEnableCollision(false);
@@ -63,7 +59,11 @@ ASFW_HeadLamp::ASFW_HeadLamp()
 void ASFW_HeadLamp::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(ASFW_HeadLamp, bLampEnabled);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_HeadLamp, bLampEnabled, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_HeadLamp, ToggleEvent, Params);
 }
 
 UPrimitiveComponent* ASFW_HeadLamp::GetPhysicsComponent() const
@@ -106,6 +106,16 @@ void ASFW_HeadLamp::OnUnequipped()
 	Super::OnUnequipped();
 }
 
+void ASFW_HeadLamp::OnReturnedToPool()
+{
+	if (bLampEnabled)
+	{
+		SetLampEnabled(false);
+	}
+
+	Super::OnReturnedToPool();
+}
+
 void ASFW_HeadLamp::Interact_Implementation(AController* InstigatorController)
 {
 	// Special-case: this does NOT go into handheld inventory.
@@ -155,24 +165,41 @@ void ASFW_HeadLamp::SetLampEnabled(bool bEnabled)
 		return;
 	}
 
+	FlushNetDormancy();
 	bLampEnabled = bEnabled;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_HeadLamp, bLampEnabled, this);
+
+	ToggleEvent.Fire(this, bEnabled ? 1 : 2, GetActorLocation());
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_HeadLamp, ToggleEvent, this);
+
 	ApplyLightState();
-	Multicast_PlayToggleSFX(bLampEnabled);
+	OnRep_ToggleEvent();
 }
 
 void ASFW_HeadLamp::Server_SetLampEnabled_Implementation(bool bEnabled)
 {
-	bLampEnabled = bEnabled;
-	ApplyLightState();
-	Multicast_PlayToggleSFX(bLampEnabled);
+	SetLampEnabled(bEnabled);
 }
 
 void ASFW_HeadLamp::OnRep_LampEnabled()
 {
-	// Clients just mirror visuals; SFX comes from multicast
+	// Clients just mirror visuals; SFX comes from ToggleEvent
 	ApplyLightState();
 }
 
+void ASFW_HeadLamp::OnRep_ToggleEvent()
+{
+	if (ToggleReceiver.Receive(this, ToggleEvent, 0.5f) != ESFWCosmeticEventReceipt::Play)
+	{
+		return;
+	}
+
+	if (USoundBase* S = GetPowerSFX(ToggleEvent.Type == 1))
+	{
+		UGameplayStatics::PlaySoundAtLocation(this, S, GetActorLocation());
+	}
+}
+
 void ASFW_HeadLamp::ApplyLightState()
 {
 	const bool bVis = bLampEnabled;
@@ -184,14 +211,13 @@ void ASFW_HeadLamp::ApplyLightState()
 		Lamp->SetInnerConeAngle(InnerCone);
 		Lamp->SetOuterConeAngle(OuterCone);
 		Lamp->SetAttenuationRadius(AttenuationRadius);
-	}
-}
 
-void ASFW_HeadLamp::Multicast_PlayToggleSFX_Implementation(bool bNewEnabled)
-{
-	USoundBase* S = bNewEnabled ? ToggleOnSFX : ToggleOffSFX;
-	if (S)
-	{
-		UGameplayStatics::PlaySoundAtLocation(this, S, GetActorLocation());
+		// Streamed in; re-applied from OnPresentationAssetsLoaded
+		if (UTextureLightProfile* IES = GetIESProfile())
+		{
+			Lamp->SetIESTexture(IES);
+			Lamp->bUseIESBrightness = bUseIESBrightness;
+			Lamp->IESBrightnessScale = IESBrightnessScale;
+		}
 	}
 }
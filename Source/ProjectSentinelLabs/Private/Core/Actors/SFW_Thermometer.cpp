@@ -3,25 +3,14 @@
 #include "Core/Actors/SFW_Thermometer.h"
 
 #include "Components/StaticMeshComponent.h"
-#include "Components/SkeletalMeshComponent.h"
-#include "Components/PrimitiveComponent.h"
-#include "GameFramework/Character.h"
+#include "Materials/MaterialInstanceDynamic.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 ASFW_Thermometer::ASFW_Thermometer()
 {
-	PrimaryActorTick.bCanEverTick = false;
-	bReplicates = true;
-	bNetUseOwnerRelevancy = true;
-
-	ThermoMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("ThermoMesh"));
-	ThermoMesh->SetupAttachment(GetMesh());
-	ThermoMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	ThermoMesh->SetCastShadow(true);
-	ThermoMesh->SetIsReplicated(true);
-	ThermoMesh->SetVisibility(true, true);
-
-	bIsActive = false;
+	CreateDeviceComponents(TEXT("ThermoMesh"));
+
 	CurrentTemperature = 20.0f;
 
 	EquipSlot = ESFWEquipSlot::Hand_Thermo;
@@ -36,7 +25,6 @@ void ASFW_Thermometer::BeginPlay()
 		ScreenMID = ScreenMesh->CreateAndSetMaterialInstanceDynamic(0);
 	}
 
-	ApplyActiveState();
 	ApplyTemperatureVisual();
 }
 
@@ -44,47 +32,15 @@ void ASFW_Thermometer::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ASFW_Thermometer, bIsActive);
-	DOREPLIFETIME(ASFW_Thermometer, CurrentTemperature);
-}
-
-UPrimitiveComponent* ASFW_Thermometer::GetPhysicsComponent() const
-{
-	return ThermoMesh ? ThermoMesh : Super::GetPhysicsComponent();
-}
-
-void ASFW_Thermometer::OnEquipped(ACharacter* NewOwnerChar)
-{
-	Super::OnEquipped(NewOwnerChar);
-
-	if (ThermoMesh)
-	{
-		ThermoMesh->SetSimulatePhysics(false);
-		ThermoMesh->SetEnableGravity(false);
-		ThermoMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-		ThermoMesh->SetVisibility(true, true);
-	}
-
-	ApplyActiveState();
-	ApplyTemperatureVisual();
-}
-
-void ASFW_Thermometer::OnUnequipped()
-{
-	if (ThermoMesh)
-	{
-		ThermoMesh->SetSimulatePhysics(false);
-		ThermoMesh->SetEnableGravity(false);
-		ThermoMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
-	}
-
-	Super::OnUnequipped();
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_Thermometer, CurrentTemperature, Params);
 }
 
 void ASFW_Thermometer::PrimaryUse()
 {
 	// Simple toggle for now
-	SetActive(!bIsActive);
+	TogglePower();
 }
 
 EHeldItemType ASFW_Thermometer::GetAnimHeldType_Implementation() const
@@ -92,40 +48,24 @@ EHeldItemType ASFW_Thermometer::GetAnimHeldType_Implementation() const
 	return EHeldItemType::Thermometer;
 }
 
-void ASFW_Thermometer::SetActive(bool bEnable)
-{
-	if (!HasAuthority())
-	{
-		// You can add a Server_SetActive RPC later if you want strict server control
-		bIsActive = bEnable;
-		ApplyActiveState();
-		return;
-	}
-
-	bIsActive = bEnable;
-	ApplyActiveState();
-}
-
 void ASFW_Thermometer::Server_SetTemperature_Implementation(float NewTempCelsius)
 {
+	FlushNetDormancy();
 	CurrentTemperature = NewTempCelsius;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_Thermometer, CurrentTemperature, this);
 	ApplyTemperatureVisual();
 }
 
-void ASFW_Thermometer::OnRep_IsActive()
-{
-	ApplyActiveState();
-}
-
 void ASFW_Thermometer::OnRep_CurrentTemperature()
 {
 	ApplyTemperatureVisual();
 }
 
-void ASFW_Thermometer::ApplyActiveState()
+void ASFW_Thermometer::OnPowerChanged(bool bOn)
 {
 	// Placeholder. Later you can drive a screen emissive / beep, etc.
 	// For now this just exists so you can hook materials or audio in BP.
+	ApplyTemperatureVisual();
 }
 
 void ASFW_Thermometer::ApplyTemperatureVisual()
@@ -9,6 +9,7 @@
 #include "Core/Components/SFW_EquipmentManagerComponent.h"
 #include "Core/Actors/SFW_EquippableBase.h"
 #include "Core/Actors/SFW_HeadLamp.h"
+#include "Core/Actors/SFW_EquippablePoolSubsystem.h"
 
 ASFW_WorldPickup::ASFW_WorldPickup()
 {
@@ -56,14 +57,21 @@ void ASFW_WorldPickup::Server_GiveTo_Implementation(AController* InstigatorContr
 	USFW_EquipmentManagerComponent* Equip = Char->FindComponentByClass<USFW_EquipmentManagerComponent>();
 	if (!Equip) return;
 
-	// Spawn the actual equippable
-	FActorSpawnParameters Params;
-	Params.Owner = Char;
-	Params.Instigator = Char;
-	Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-	
+	// Take the actual equippable from the pool (prewarmed at round start)
+	ASFW_EquippableBase* Spawned = nullptr;
+	if (USFW_EquippablePoolSubsystem* Pool = USFW_EquippablePoolSubsystem::Get(this))
+	{
+		Spawned = Pool->Acquire(ItemClass, GetActorTransform(), Char, Char);
+	}
+	else
+	{
+		FActorSpawnParameters Params;
+		Params.Owner = Char;
+		Params.Instigator = Char;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
 
-	ASFW_EquippableBase* Spawned = GetWorld()->SpawnActor<ASFW_EquippableBase>(ItemClass, GetActorTransform(), Params);
+		Spawned = GetWorld()->SpawnActor<ASFW_EquippableBase>(ItemClass, GetActorTransform(), Params);
+	}
 	if (!Spawned) return;
 
 	// Headlamp = special dedicated slot (not a handheld inventory item)
@@ -142,11 +142,9 @@ void ASFW_AnomalyController::StartRound()
 	{
 		const float Now = GetWorld()->GetTimeSeconds();
 
-		G->bRoundActive = true;
-		G->RoundStartTime = Now;
-		G->RoundSeed = FMath::Rand();
-		G->BaseRoom = BaseRoom;
-		G->RiftRoom = RiftRoom;
+		G->SetRoundActive(true);
+		G->SetRoundStart(Now, FMath::Rand());
+		G->SetRoundRooms(BaseRoom, RiftRoom);
 
 		// If you later add this to GameState, you can also mirror:
 		// G->ActiveAnomalyType = ActiveAnomalyType;
@@ -8,6 +8,7 @@
 #include "GameFramework/Pawn.h"
 #include "Core/Rooms/RoomVolume.h"
 #include "Core/Game/SFW_PlayerState.h"
+#include "Core/Game/SFW_GameState.h"
 
 
 // ---- Player-only room occupancy (ignores SafeRoom and similar) ----
@@ -16,6 +17,9 @@ static void GetOccupiedRooms(UWorld* World, TArray<FName>& Out)
 	Out.Reset();
 	if (!World) return;
 
+	const ASFW_GameState* GS = World->GetGameState<ASFW_GameState>();
+	if (!GS) return;
+
 	TSet<FName> Unique;
 
 	for (TActorIterator<ARoomVolume> It(World); It; ++It)
@@ -24,19 +28,9 @@ static void GetOccupiedRooms(UWorld* World, TArray<FName>& Out)
 		if (!Vol || Vol->RoomId.IsNone()) continue;
 		if (Vol->bIsSafeRoom) continue; // do not target safe rooms
 
-		TArray<AActor*> Over;
-		Vol->GetOverlappingActors(Over, APawn::StaticClass());
-
-		for (AActor* A : Over)
+		if (GS->GetRoomOccupancyMask(Vol->GetRoomIndex()) != 0u)
 		{
-			if (APawn* P = Cast<APawn>(A))
-			{
-				if (P->IsPlayerControlled())
-				{
-					Unique.Add(Vol->RoomId);
-					break;
-				}
-			}
+			Unique.Add(Vol->RoomId);
 		}
 	}
 
@@ -343,25 +337,18 @@ int32 ASFW_AnomalyDecisionSystem::GetRoomTier(FName RoomId) const
 {
 	int32 MaxTier = 1;
 
-	for (TActorIterator<ARoomVolume> It(GetWorld()); It; ++It)
-	{
-		ARoomVolume* Vol = *It;
-		if (!Vol || Vol->RoomId != RoomId) continue;
+	const ASFW_GameState* GS = GetWorld() ? GetWorld()->GetGameState<ASFW_GameState>() : nullptr;
+	if (!GS) return MaxTier;
 
-		TArray<AActor*> Over;
-		Vol->GetOverlappingActors(Over, APawn::StaticClass());
+	TArray<APlayerState*> Occupants;
+	GS->GetPlayersInRoom(RoomId, Occupants);
 
-		for (AActor* A : Over)
+	for (APlayerState* Generic : Occupants)
+	{
+		if (const ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(Generic))
 		{
-			APawn* P = Cast<APawn>(A);
-			if (!P || !P->IsPlayerControlled()) continue;
-
-			if (ASFW_PlayerState* PS = P->GetPlayerState<ASFW_PlayerState>())
-			{
-				MaxTier = FMath::Max(MaxTier, SanityTierToInt(PS->GetSanityTier()));
-			}
+			MaxTier = FMath::Max(MaxTier, SanityTierToInt(PS->GetSanityTier()));
 		}
-		break;
 	}
 
 	return MaxTier;
@@ -0,0 +1,199 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/AnomalySystems/SFW_PropPulseSubsystem.h"
+#include "Core/Components/SFW_AnomalyPropComponent.h"
+
+#include "Components/SceneComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+USFW_PropPulseSubsystem* USFW_PropPulseSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_PropPulseSubsystem>() : nullptr;
+}
+
+bool USFW_PropPulseSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Purely cosmetic; nothing to draw on a dedicated server.
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+}
+
+bool USFW_PropPulseSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_PropPulseSubsystem::Deinitialize()
+{
+	while (Props.Num() > 0)
+	{
+		RemoveAt(Props.Num() - 1, /*bRestore*/ false);
+	}
+	Super::Deinitialize();
+}
+
+TStatId USFW_PropPulseSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USFW_PropPulseSubsystem, STATGROUP_Tickables);
+}
+
+float USFW_PropPulseSubsystem::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GS = World->GetGameState();
+	return GS ? static_cast<float>(GS->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+void USFW_PropPulseSubsystem::AddPulse(USFW_AnomalyPropComponent* Prop, USceneComponent* Visual, const FSFWPropPulse& Pulse,
+	float AngularFreq, float BobAmplitude, float TwistAmplitudeDeg)
+{
+	if (!Prop || !Visual)
+	{
+		return;
+	}
+
+	int32 Slot = Prop->PulseSlot;
+	if (Slot == INDEX_NONE)
+	{
+		Slot = Props.Add(Prop);
+		Visuals.Add(Visual);
+		BaseTransforms.AddDefaulted();
+		StartTimes.AddDefaulted();
+		EndTimes.AddDefaulted();
+		AngularFreqs.AddDefaulted();
+		BobAmplitudes.AddDefaulted();
+		TwistAmplitudes.AddDefaulted();
+		Prop->PulseSlot = Slot;
+	}
+	else
+	{
+		// Restarting mid-pulse: rest pose is the unmodified transform, not the bobbed one.
+		if (USceneComponent* Old = Visuals[Slot].Get())
+		{
+			Old->UpdateComponentToWorld();
+		}
+		Visuals[Slot] = Visual;
+	}
+
+	BaseTransforms[Slot] = Visual->GetComponentTransform();
+	StartTimes[Slot] = Pulse.StartTime;
+	EndTimes[Slot] = Pulse.StartTime + Pulse.Duration;
+	AngularFreqs[Slot] = AngularFreq;
+	BobAmplitudes[Slot] = BobAmplitude;
+	TwistAmplitudes[Slot] = FMath::DegreesToRadians(TwistAmplitudeDeg);
+}
+
+void USFW_PropPulseSubsystem::RemovePulse(USFW_AnomalyPropComponent* Prop)
+{
+	if (Prop && Props.IsValidIndex(Prop->PulseSlot))
+	{
+		RemoveAt(Prop->PulseSlot, /*bRestore*/ true);
+	}
+}
+
+void USFW_PropPulseSubsystem::RemoveAt(int32 Slot, bool bRestore)
+{
+	if (USFW_AnomalyPropComponent* Prop = Props[Slot].Get())
+	{
+		Prop->PulseSlot = INDEX_NONE;
+	}
+
+	if (bRestore)
+	{
+		// Rebuild from the untouched relative transform.
+		if (USceneComponent* Visual = Visuals[Slot].Get())
+		{
+			Visual->UpdateComponentToWorld();
+			Visual->MarkRenderTransformDirty();
+		}
+	}
+
+	Props.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	Visuals.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BaseTransforms.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	StartTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	EndTimes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	AngularFreqs.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	BobAmplitudes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+	TwistAmplitudes.RemoveAtSwap(Slot, 1, EAllowShrinking::No);
+
+	// Whatever was last now lives in Slot.
+	if (Props.IsValidIndex(Slot))
+	{
+		if (USFW_AnomalyPropComponent* Moved = Props[Slot].Get())
+		{
+			Moved->PulseSlot = Slot;
+		}
+	}
+}
+
+void USFW_PropPulseSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	const int32 Num = Props.Num();
+	if (Num == 0)
+	{
+		return;
+	}
+
+	const float Now = GetServerTime();
+
+	// ---------- Retire finished / dead pulses ----------
+	for (int32 i = Num - 1; i >= 0; --i)
+	{
+		if (Now >= EndTimes[i] || !Visuals[i].IsValid() || !Props[i].IsValid())
+		{
+			RemoveAt(i, /*bRestore*/ true);
+		}
+	}
+
+	const int32 Active = Props.Num();
+	if (Active == 0)
+	{
+		return;
+	}
+
+	// ---------- Phases ----------
+	// bob: sin(w t), twist: sin(2 w t)
+	const int32 Padded = Align(Active * 2, 4);
+	Scratch.SetNumUninitialized(Padded, EAllowShrinking::No);
+	float* Phases = Scratch.GetData();
+	for (int32 i = 0; i < Active; ++i)
+	{
+		const float P = FMath::Max(0.f, Now - StartTimes[i]) * AngularFreqs[i];
+		Phases[i] = P;
+		Phases[Active + i] = 2.f * P;
+	}
+	for (int32 i = Active * 2; i < Padded; ++i)
+	{
+		Phases[i] = 0.f;
+	}
+
+	// ---------- 4-wide sin ----------
+	for (int32 i = 0; i < Padded; i += 4)
+	{
+		VectorStore(VectorSin(VectorLoad(Phases + i)), Phases + i);
+	}
+
+	// ---------- Render transforms ----------
+	for (int32 i = 0; i < Active; ++i)
+	{
+		USceneComponent* Visual = Visuals[i].Get();
+		const FTransform& Base = BaseTransforms[i];
+
+		FTransform Out = Base;
+		Out.AddToTranslation(FVector(0.f, 0.f, Phases[i] * BobAmplitudes[i]));
+		Out.SetRotation(FQuat(FVector::UpVector, Phases[Active + i] * TwistAmplitudes[i]) * Base.GetRotation());
+
+		// Render-only: skip physics, overlaps and child propagation.
+		Visual->SetComponentToWorld(Out);
+		Visual->MarkRenderTransformDirty();
+	}
+}
@@ -5,32 +5,80 @@
 #include "Core/Components/SFW_AnomalyPropComponent.h"
 
 #include "Core/Lights/SFW_PowerLibrary.h"
+#include "Core/AnomalySystems/SFW_PropPulseSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "Core/Rooms/RoomVolume.h"
 #include "Engine/World.h"
+#include "Components/MeshComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 USFW_AnomalyPropComponent::USFW_AnomalyPropComponent()
 {
-	PrimaryComponentTick.bCanEverTick = true;
-	SetComponentTickEnabled(false); // only tick while pulsing
+	PrimaryComponentTick.bCanEverTick = false; // animated by USFW_PropPulseSubsystem
+	SetIsReplicatedByDefault(true);
 }
 
-void USFW_AnomalyPropComponent::BeginPlay()
+void USFW_AnomalyPropComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
-	Super::BeginPlay();
-	// No caching here; we cache at pulse start so props that move still work.
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_AnomalyPropComponent, Pulse, Params);
 }
 
-void USFW_AnomalyPropComponent::TriggerAnomalyPulse(float PulseDurationSec)
+void USFW_AnomalyPropComponent::BeginPlay()
 {
+	Super::BeginPlay();
+
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
 		return;
 	}
 
-	UWorld* World = Owner->GetWorld();
+	// Level props are often non-replicated; the pulse struct needs a channel.
+	if (Owner->HasAuthority() && !Owner->GetIsReplicated())
+	{
+		Owner->SetReplicates(true);
+	}
+
+	if (!VisualComp)
+	{
+		VisualComp = Owner->FindComponentByClass<UMeshComponent>();
+	}
+}
+
+void USFW_AnomalyPropComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopPulse();
+	Super::EndPlay(EndPlayReason);
+}
+
+void USFW_AnomalyPropComponent::SetVisualComponent(USceneComponent* InVisual)
+{
+	StopPulse();
+	VisualComp = InVisual;
+}
+
+float USFW_AnomalyPropComponent::GetServerTime() const
+{
+	const UWorld* World = GetWorld();
 	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GS = World->GetGameState();
+	return GS ? static_cast<float>(GS->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+void USFW_AnomalyPropComponent::TriggerAnomalyPulse(float PulseDurationSec)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Owner->HasAuthority())
 	{
 		return;
 	}
@@ -40,97 +88,69 @@ void USFW_AnomalyPropComponent::TriggerAnomalyPulse(float PulseDurationSec)
 		*GetNameSafe(Owner),
 		PulseDurationSec);
 
-	const float Now = World->GetTimeSeconds();
-
-	// Cache current transform as the rest pose for this pulse
-	BaseLocation = Owner->GetActorLocation();
-	BaseRotation = Owner->GetActorRotation();
-
-	PulseDuration = (PulseDurationSec > 0.f) ? PulseDurationSec : DefaultPulseDuration;
-	if (PulseDuration <= 0.f)
+	const float Duration = (PulseDurationSec > 0.f) ? PulseDurationSec : DefaultPulseDuration;
+	if (Duration <= 0.f)
 	{
 		return;
 	}
 
-	PulseStartTime = Now;
-	bPulseActive = true;
-	SetComponentTickEnabled(true);
+	Pulse.StartTime = GetServerTime();
+	Pulse.Duration = Duration;
+	Pulse.Seed = FMath::Rand();
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_AnomalyPropComponent, Pulse, this);
+	OnRep_Pulse();
 
 	// Server marks this actor as an EMF source for the pulse window
-	if (Owner->HasAuthority())
-	{
-		const float EMFSeconds = PulseDuration + FMath::Max(0.f, EMFSourceExtraSeconds);
-		USFW_PowerLibrary::MakeActorEMFSource(this, Owner, EMFSeconds);
-	}
+	const float EMFSeconds = Duration + FMath::Max(0.f, EMFSourceExtraSeconds);
+	USFW_PowerLibrary::MakeActorEMFSource(this, Owner, EMFSeconds);
 }
 
-void USFW_AnomalyPropComponent::TickComponent(
-	float DeltaTime,
-	enum ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction
-)
+void USFW_AnomalyPropComponent::OnRep_Pulse()
 {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-
-	if (!bPulseActive)
+	// Dedicated servers never draw the prop.
+	if (GetNetMode() == NM_DedicatedServer)
 	{
 		return;
 	}
 
-	UWorld* World = GetWorld();
-	AActor* Owner = GetOwner();
-	if (!World || !Owner)
+	// Late joiners can receive a pulse that already ended.
+	if (Pulse.StartTime < 0.f || GetServerTime() - Pulse.StartTime >= Pulse.Duration)
 	{
 		StopPulse();
 		return;
 	}
 
-	const float Now = World->GetTimeSeconds();
-	const float Elapsed = Now - PulseStartTime;
+	StartLocalPulse();
+}
 
-	if (Elapsed >= PulseDuration)
+void USFW_AnomalyPropComponent::StartLocalPulse()
+{
+	USFW_PropPulseSubsystem* Pulses = USFW_PropPulseSubsystem::Get(this);
+	if (!VisualComp || !Pulses)
 	{
-		StopPulse();
 		return;
 	}
 
-	// Basic bob + twist:
-	// - vertical bob: sin(phase) * MaxOffset
-	// - yaw wobble:   sin(phase * 2) * MaxAngleDeg
-	const float Phase = Elapsed * PulseFrequency * 2.f * UE_PI;
-	const float OffsetZ = FMath::Sin(Phase) * MaxOffset;
-	const float ExtraYaw = FMath::Sin(Phase * 2.f) * MaxAngleDeg;
-	
-	FVector NewLocation = BaseLocation;
-	NewLocation.Z += OffsetZ;
-
-	FRotator NewRotation = BaseRotation;
-	NewRotation.Yaw += ExtraYaw;
-
-	Owner->SetActorLocationAndRotation(
-		NewLocation,
-		NewRotation,
-		false,
-		nullptr,
-		ETeleportType::None
-	);
+	// Seed gives each pulse its own frequency jitter and twist direction.
+	FRandomStream Stream(Pulse.Seed);
+	const float FrequencyScale = Stream.FRandRange(0.9f, 1.1f);
+	const float TwistSign = Stream.FRand() < 0.5f ? -1.f : 1.f;
+
+	Pulses->AddPulse(this, VisualComp, Pulse,
+		PulseFrequency * FrequencyScale * 2.f * UE_PI,
+		MaxOffset,
+		MaxAngleDeg * TwistSign);
 }
 
 void USFW_AnomalyPropComponent::StopPulse()
 {
-	bPulseActive = false;
-	SetComponentTickEnabled(false);
+	if (PulseSlot == INDEX_NONE)
+	{
+		return;
+	}
 
-	if (AActor* Owner = GetOwner())
+	if (USFW_PropPulseSubsystem* Pulses = USFW_PropPulseSubsystem::Get(this))
 	{
-		Owner->SetActorLocationAndRotation(
-			BaseLocation,
-			BaseRotation,
-			false,
-			nullptr,
-			ETeleportType::None
-		);
+		Pulses->RemovePulse(this);
 	}
 }
-
-
@@ -8,16 +8,103 @@
 
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Materials/MaterialInterface.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Engine/World.h"
 #include "Engine/EngineTypes.h"
-#include "DrawDebugHelpers.h"
+
+namespace
+{
+	/** Keys wrap and skip 0; Acked answers Pending if it is not older. */
+	bool IsPredictionKeyAnswered(uint8 Acked, uint8 Pending)
+	{
+		return static_cast<int8>(static_cast<uint8>(Acked - Pending)) >= 0;
+	}
+}
+
+// ---------- Inventory list ----------
+
+void FSFWInventoryList::PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters)
+{
+	// Newly carried items need stowing on this peer too.
+	if (OwnerComponent)
+	{
+		OwnerComponent->ApplyActiveVisuals();
+	}
+}
+
+void FSFWInventoryList::Init(int32 NumSlots)
+{
+	if (Slots.Num() == NumSlots)
+	{
+		return;
+	}
+
+	Slots.Reset(NumSlots);
+	for (int32 i = 0; i < NumSlots; ++i)
+	{
+		FSFWInventorySlot& Slot = Slots.AddDefaulted_GetRef();
+		Slot.SlotIndex = i;
+		MarkItemDirty(Slot);
+	}
+}
+
+ASFW_EquippableBase* FSFWInventoryList::GetItem(int32 SlotIndex) const
+{
+	for (const FSFWInventorySlot& Slot : Slots)
+	{
+		if (Slot.SlotIndex == SlotIndex)
+		{
+			return Slot.Item;
+		}
+	}
+	return nullptr;
+}
+
+bool FSFWInventoryList::SetItem(int32 SlotIndex, ASFW_EquippableBase* Item)
+{
+	for (FSFWInventorySlot& Slot : Slots)
+	{
+		if (Slot.SlotIndex == SlotIndex)
+		{
+			if (Slot.Item != Item)
+			{
+				Slot.Item = Item;
+				MarkItemDirty(Slot);
+			}
+			return true;
+		}
+	}
+	return false;
+}
+
+int32 FSFWInventoryList::FindSlot(const ASFW_EquippableBase* Item) const
+{
+	if (Item)
+	{
+		for (const FSFWInventorySlot& Slot : Slots)
+		{
+			if (Slot.Item == Item)
+			{
+				return Slot.SlotIndex;
+			}
+		}
+	}
+	return INDEX_NONE;
+}
+
+// ---------- Component ----------
 
 USFW_EquipmentManagerComponent::USFW_EquipmentManagerComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// Ticks only on the owning client while a placeable item is in hand (placement preview).
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 	SetIsReplicatedByDefault(true);
-	Inventory.SetNumZeroed(kMaxInventorySlots);
+	Inventory.OwnerComponent = this;
 }
 
 void USFW_EquipmentManagerComponent::BeginPlay()
@@ -25,21 +112,41 @@ void USFW_EquipmentManagerComponent::BeginPlay()
 	Super::BeginPlay();
 
 	OwnerChar = Cast<ACharacter>(GetOwner());
-	if (Inventory.Num() != kMaxInventorySlots)
+
+	// Slots exist on the server only; clients receive them through the fast array.
+	if (GetOwner() && GetOwner()->HasAuthority())
 	{
-		Inventory.SetNumZeroed(kMaxInventorySlots);
+		Inventory.Init(kMaxInventorySlots);
+		MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, Inventory, this);
 	}
+
+	PlacementTraceDelegate.BindUObject(this, &USFW_EquipmentManagerComponent::OnPlacementTraceDone);
+}
+
+void USFW_EquipmentManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (PlacementGhost)
+	{
+		PlacementGhost->DestroyComponent();
+		PlacementGhost = nullptr;
+	}
+
+	PlacementTraceDelegate.Unbind();
+	PlacementTrace = FTraceHandle();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void USFW_EquipmentManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(USFW_EquipmentManagerComponent, Inventory);
-	DOREPLIFETIME(USFW_EquipmentManagerComponent, ActiveHandItem);
-	DOREPLIFETIME(USFW_EquipmentManagerComponent, HeadLampRef);
-	DOREPLIFETIME(USFW_EquipmentManagerComponent, HeldItem);
-	DOREPLIFETIME(USFW_EquipmentManagerComponent, Equip);
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_EquipmentManagerComponent, Inventory, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_EquipmentManagerComponent, Hand, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_EquipmentManagerComponent, HeadLampRef, Params);
 }
 
 // ---------- Queries ----------
@@ -48,7 +155,7 @@ bool USFW_EquipmentManagerComponent::HasFreeInventorySlot(int32& OutIndex) const
 {
 	for (int32 i = 0; i < kMaxInventorySlots; ++i)
 	{
-		if (Inventory[i] == nullptr)
+		if (Inventory.GetItem(i) == nullptr)
 		{
 			OutIndex = i;
 			return true;
@@ -66,14 +173,14 @@ bool USFW_EquipmentManagerComponent::IsInventoryFull() const
 
 ASFW_EquippableBase* USFW_EquipmentManagerComponent::GetItemInSlot(int32 Index) const
 {
-	return IsValidSlotIndex(Index) ? Inventory[Index] : nullptr;
+	return IsValidSlotIndex(Index) ? Inventory.GetItem(Index) : nullptr;
 }
 
 bool USFW_EquipmentManagerComponent::CanUseRadioComms() const
 {
-	for (ASFW_EquippableBase* Item : Inventory)
+	for (const FSFWInventorySlot& Slot : Inventory.Slots)
 	{
-		if (Item && Item->GrantsRadioComms())
+		if (Slot.Item && Slot.Item->GrantsRadioComms())
 		{
 			return true;
 		}
@@ -85,8 +192,8 @@ bool USFW_EquipmentManagerComponent::CanUseRadioComms() const
 
 bool USFW_EquipmentManagerComponent::SetItemInSlot_Internal(int32 Index, ASFW_EquippableBase* Item)
 {
-	if (!IsValidSlotIndex(Index)) return false;
-	Inventory[Index] = Item;
+	if (!IsValidSlotIndex(Index) || !Inventory.SetItem(Index, Item)) return false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, Inventory, this);
 	return true;
 }
 
@@ -94,57 +201,161 @@ bool USFW_EquipmentManagerComponent::ClearSlot_Internal(int32 Index)
 {
 	if (!IsValidSlotIndex(Index)) return false;
 
-	if (Inventory[Index] && Inventory[Index] == ActiveHandItem)
+	ASFW_EquippableBase* Item = Inventory.GetItem(Index);
+	if (Item && Item == Hand.Item)
 	{
-		ActiveHandItem = nullptr;
+		SetActiveHandItem_Internal(nullptr);
 	}
-	Inventory[Index] = nullptr;
+	if (!Inventory.SetItem(Index, nullptr)) return false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, Inventory, this);
 	return true;
 }
 
+FSFWHandState USFW_EquipmentManagerComponent::MakeHandState(ASFW_EquippableBase* Item, uint8 PredictionKey)
+{
+	FSFWHandState State;
+	State.Item = Item;
+	State.HeldItem = Item ? Item->GetAnimHeldType() : EHeldItemType::None;
+	State.Equip = Item ? EEquipState::Holding : EEquipState::Idle;
+	State.PredictionKey = PredictionKey;
+	return State;
+}
+
+void USFW_EquipmentManagerComponent::SetActiveHandItem_Internal(ASFW_EquippableBase* Item)
+{
+	Hand = MakeHandState(Item, Hand.PredictionKey);
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, Hand, this);
+
+	// Server callers refresh visuals themselves once inventory is settled.
+	ActiveHandItem = Hand.Item;
+	HeldItem = Hand.HeldItem;
+	Equip = Hand.Equip;
+}
+
+void USFW_EquipmentManagerComponent::ApplyHandState(const FSFWHandState& State)
+{
+	ActiveHandItem = State.Item;
+	HeldItem = State.HeldItem;
+	Equip = State.Equip;
+
+	ApplyActiveVisuals();
+}
+
 void USFW_EquipmentManagerComponent::SetHeadLamp(ASFW_EquippableBase* InHeadLamp)
 {
+	if (InHeadLamp)
+	{
+		InHeadLamp->SetNetDormancy(DORM_Awake);
+	}
 	HeadLampRef = InHeadLamp;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, HeadLampRef, this);
 }
 
-void USFW_EquipmentManagerComponent::OnRep_ActiveHandItem()
+void USFW_EquipmentManagerComponent::RemoveAllItems(TArray<ASFW_EquippableBase*>& OutItems)
 {
+	if (!GetOwner() || !GetOwner()->HasAuthority())
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < kMaxInventorySlots; ++i)
+	{
+		if (ASFW_EquippableBase* Item = GetItemInSlot(i))
+		{
+			OutItems.Add(Item);
+			ClearSlot_Internal(i);
+		}
+	}
+	SetActiveHandItem_Internal(nullptr);
+
+	if (HeadLampRef)
+	{
+		OutItems.Add(HeadLampRef);
+		SetHeadLamp(nullptr);
+	}
+
 	ApplyActiveVisuals();
 }
 
+void USFW_EquipmentManagerComponent::OnRep_Hand()
+{
+	if (PendingPredictionKey != 0)
+	{
+		if (!IsPredictionKeyAnswered(Hand.PredictionKey, PendingPredictionKey))
+		{
+			// Server has not seen our latest equip yet; keep showing the prediction.
+			return;
+		}
+
+		// Confirmed or rejected: either way the server's hand is now the truth.
+		PendingPredictionKey = 0;
+	}
+
+	ApplyHandState(Hand);
+}
+
 void USFW_EquipmentManagerComponent::ApplyActiveVisuals()
 {
-	UE_LOG(LogTemp, Log, TEXT("[EquipMgr] ApplyActiveVisuals Owner=%s ActiveHandItem=%s"),
-		*GetOwner()->GetName(),
-		ActiveHandItem ? *ActiveHandItem->GetName() : TEXT("NULL"));
+	ASFW_EquippableBase* NewHand = OwnerChar ? ActiveHandItem.Get() : nullptr;
 
-	// Hide / detach everything first
-	for (ASFW_EquippableBase* Item : Inventory)
+	// ---------- Forget items that left the inventory ----------
+	// Drop / place already set their own visuals; don't touch them here.
+	for (int32 i = VisualCarried.Num() - 1; i >= 0; --i)
 	{
-		if (Item)
+		ASFW_EquippableBase* Item = VisualCarried[i].Get();
+		if (!Item || (Item != NewHand && Inventory.FindSlot(Item) == INDEX_NONE))
 		{
-			Item->OnUnequipped();
+			VisualCarried.RemoveAtSwap(i, 1, EAllowShrinking::No);
 		}
 	}
 
-	// Then show/attach the active item
-	if (ActiveHandItem && OwnerChar)
+	ASFW_EquippableBase* OldHand = VisualHandItem.Get();
+	if (OldHand && !VisualCarried.Contains(OldHand))
+	{
+		OldHand = nullptr;
+	}
+
+	// ---------- Hand swap: only the two items involved ----------
+	if (OldHand != NewHand)
 	{
-		UE_LOG(LogTemp, Log, TEXT("[EquipMgr] Equipping %s to %s"),
-			*ActiveHandItem->GetName(),
-			*OwnerChar->GetName());
+		UE_LOG(LogTemp, Verbose, TEXT("[EquipMgr] Hand %s -> %s on %s"),
+			OldHand ? *OldHand->GetName() : TEXT("NULL"),
+			NewHand ? *NewHand->GetName() : TEXT("NULL"),
+			*GetOwner()->GetName());
+
+		if (OldHand)
+		{
+			OldHand->OnUnequipped();
+		}
+		if (NewHand)
+		{
+			NewHand->OnEquipped(OwnerChar);
+			VisualCarried.AddUnique(NewHand);
+		}
+	}
+	VisualHandItem = NewHand;
 
-		ActiveHandItem->OnEquipped(OwnerChar);
+	// ---------- Stow newly carried items ----------
+	for (const FSFWInventorySlot& Slot : Inventory.Slots)
+	{
+		ASFW_EquippableBase* Item = Slot.Item;
+		if (Item && Item != NewHand && !VisualCarried.Contains(Item))
+		{
+			Item->OnUnequipped();
+			VisualCarried.Add(Item);
+		}
 	}
+
+	RefreshPlacementPreview();
 }
 
 ASFW_EMFDevice* USFW_EquipmentManagerComponent::FindEMF() const
 {
-	for (ASFW_EquippableBase* Item : Inventory)
+	for (const FSFWInventorySlot& Slot : Inventory.Slots)
 	{
-		if (!Item) continue;
+		if (!Slot.Item) continue;
 
-		if (ASFW_EMFDevice* EMF = Cast<ASFW_EMFDevice>(Item))
+		if (ASFW_EMFDevice* EMF = Cast<ASFW_EMFDevice>(Slot.Item))
 		{
 			return EMF;
 		}
@@ -156,7 +367,7 @@ ASFW_EMFDevice* USFW_EquipmentManagerComponent::FindEMF() const
 
 void USFW_EquipmentManagerComponent::Server_AddItemToInventory_Implementation(ASFW_EquippableBase* Item, bool bAutoEquipIfHandEmpty)
 {
-	UE_LOG(LogTemp, Log, TEXT("[EquipMgr] AddItemToInventory called on %s. Item=%s AutoEquip=%d"),
+	UE_LOG(LogTemp, Verbose, TEXT("[EquipMgr] AddItemToInventory called on %s. Item=%s AutoEquip=%d"),
 		*GetOwner()->GetName(),
 		Item ? *Item->GetName() : TEXT("NULL"),
 		bAutoEquipIfHandEmpty ? 1 : 0);
@@ -170,45 +381,76 @@ void USFW_EquipmentManagerComponent::Server_AddItemToInventory_Implementation(AS
 		return;
 	}
 
+	// Carried items replicate normally (owner-only via the rep graph); see ASFW_EquippableBase::SettleNetDormancy
+	Item->SetNetDormancy(DORM_Awake);
 	SetItemInSlot_Internal(FreeIndex, Item);
-	UE_LOG(LogTemp, Log, TEXT("[EquipMgr] Stored %s in slot %d"), *Item->GetName(), FreeIndex);
+	UE_LOG(LogTemp, Verbose, TEXT("[EquipMgr] Stored %s in slot %d"), *Item->GetName(), FreeIndex);
 
-	if (bAutoEquipIfHandEmpty && ActiveHandItem == nullptr)
+	if (bAutoEquipIfHandEmpty && Hand.Item == nullptr)
 	{
-		ActiveHandItem = Item;
-		HeldItem = ActiveHandItem
-			? ActiveHandItem->GetAnimHeldType()
-			: EHeldItemType::None;
-		Equip = EEquipState::Holding;
+		SetActiveHandItem_Internal(Item);
 
-		UE_LOG(LogTemp, Log, TEXT("[EquipMgr] Auto-equipped %s as ActiveHandItem"), *Item->GetName());
+		UE_LOG(LogTemp, Verbose, TEXT("[EquipMgr] Auto-equipped %s as ActiveHandItem"), *Item->GetName());
 	}
 
 	ApplyActiveVisuals();
 }
 
-void USFW_EquipmentManagerComponent::Server_EquipSlot_Implementation(int32 SlotIndex)
+void USFW_EquipmentManagerComponent::EquipSlot(int32 SlotIndex)
 {
-	if (!IsValidSlotIndex(SlotIndex)) return;
+	const AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	if (Owner->HasAuthority())
+	{
+		Server_EquipSlot(SlotIndex, 0);
+		return;
+	}
+
+	// Nothing to predict; the server would reject it anyway.
+	ASFW_EquippableBase* Candidate = GetItemInSlot(SlotIndex);
+	if (!Candidate)
+	{
+		return;
+	}
+
+	// 0 means "unpredicted", so skip it on wrap.
+	LastPredictionKey = (LastPredictionKey == MAX_uint8) ? 1 : LastPredictionKey + 1;
+	PendingPredictionKey = LastPredictionKey;
+
+	ApplyHandState(MakeHandState(Candidate, PendingPredictionKey));
+
+	Server_EquipSlot(SlotIndex, PendingPredictionKey);
+}
 
-	ASFW_EquippableBase* Candidate = Inventory[SlotIndex];
-	if (!Candidate) return;
+void USFW_EquipmentManagerComponent::Server_EquipSlot_Implementation(int32 SlotIndex, uint8 PredictionKey)
+{
+	// Answer the prediction even when rejecting, so the owner snaps back to Hand.
+	if (PredictionKey != 0)
+	{
+		Hand.PredictionKey = PredictionKey;
+		MARK_PROPERTY_DIRTY_FROM_NAME(USFW_EquipmentManagerComponent, Hand, this);
+	}
 
-	ActiveHandItem = Candidate;
+	ASFW_EquippableBase* Candidate = GetItemInSlot(SlotIndex);
+	if (!Candidate)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[EquipMgr] Rejected equip of slot %d on %s (key %d)"),
+			SlotIndex, *GetOwner()->GetName(), PredictionKey);
+		return;
+	}
 
-	HeldItem = ActiveHandItem
-		? ActiveHandItem->GetAnimHeldType()
-		: EHeldItemType::None;
-	Equip = ActiveHandItem ? EEquipState::Holding : EEquipState::Idle;
+	SetActiveHandItem_Internal(Candidate);
 
 	ApplyActiveVisuals();
 }
 
 void USFW_EquipmentManagerComponent::Server_UnequipActive_Implementation()
 {
-	ActiveHandItem = nullptr;
-	HeldItem = EHeldItemType::None;
-	Equip = EEquipState::Idle;
+	SetActiveHandItem_Internal(nullptr);
 
 	ApplyActiveVisuals();
 }
@@ -223,20 +465,11 @@ void USFW_EquipmentManagerComponent::Server_DropActive_Implementation()
 	ASFW_EquippableBase* Dropped = ActiveHandItem;
 
 	// Remove from inventory
-	for (int32 i = 0; i < kMaxInventorySlots; ++i)
-	{
-		if (Inventory[i] == Dropped)
-		{
-			ClearSlot_Internal(i);
-			break;
-		}
-	}
+	ClearSlot_Internal(Inventory.FindSlot(Dropped));
 
-	ActiveHandItem = nullptr;
-	HeldItem = EHeldItemType::None;
-	Equip = EEquipState::Idle;
+	SetActiveHandItem_Internal(nullptr);
 
-	ApplyActiveVisuals(); // unequips remaining items, not the dropped one
+	ApplyActiveVisuals(); // forgets the dropped one; remaining items stay stowed
 
 	// Compute drop location + toss from camera / eyes
 	FVector EyeLoc;
@@ -250,103 +483,242 @@ void USFW_EquipmentManagerComponent::Server_DropActive_Implementation()
 	// No longer owned for relevancy
 	Dropped->SetOwner(nullptr);
 
-	// Let the item configure its physics and visuals on all peers
-	Dropped->Multicast_OnDropped(DropLocation, TossVelocity);
+	// Let the item configure its physics and visuals on all relevant peers
+	Dropped->NotifyDropped(DropLocation, TossVelocity);
 }
 
-// In SFW_EquipmentManagerComponent.cpp
+// ---------- Placement ----------
 
-void USFW_EquipmentManagerComponent::Server_PlaceActive_Implementation()
+bool USFW_EquipmentManagerComponent::EvaluatePlacementHit(const FHitResult& Hit, float Yaw, FTransform& OutXform) const
 {
-	if (!OwnerChar || !ActiveHandItem)
+	const FVector Normal = Hit.ImpactNormal.GetSafeNormal();
+
+	// Keep item upright in world, yaw aligned to character
+	OutXform.SetLocation(Hit.Location + Normal * PlaceHeightOffset);
+	OutXform.SetRotation(FRotator(0.f, Yaw, 0.f).Quaternion());
+	OutXform.SetScale3D(FVector::OneVector);
+
+	// Filter to world geometry only (so you can't place on players / items)
+	ECollisionChannel HitChannel = ECC_WorldStatic;
+	if (Hit.Component.IsValid())
 	{
-		return;
+		HitChannel = Hit.Component->GetCollisionObjectType();
 	}
 
-	// Only allow items that opt into placement (REMPod returns true)
-	if (!ActiveHandItem->CanBePlaced())
+	if (HitChannel != ECC_WorldStatic && HitChannel != ECC_WorldDynamic)
 	{
-		return;
+		return false; // not ground / level geometry
+	}
+
+	// Check surface slope vs world up
+	const float DotUp = FVector::DotProduct(Normal, FVector::UpVector);
+	const float CosMaxSlope = FMath::Cos(FMath::DegreesToRadians(MaxPlaceSlopeDegrees));
+
+	// too steep -> e.g. wall, stairs, sharp slope
+	return DotUp >= CosMaxSlope;
+}
+
+void USFW_EquipmentManagerComponent::RefreshPlacementPreview()
+{
+	const bool bWantPreview =
+		OwnerChar &&
+		OwnerChar->IsLocallyControlled() &&
+		ActiveHandItem &&
+		ActiveHandItem->CanBePlaced();
+
+	SetComponentTickEnabled(bWantPreview);
+
+	if (!bWantPreview)
+	{
+		bPlacementValid = false;
+		UpdatePlacementGhost(false);
 	}
+}
+
+void USFW_EquipmentManagerComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
 	UWorld* World = GetWorld();
-	if (!World)
+	if (!World || !OwnerChar || PlacementTrace.IsValid())
 	{
-		return;
+		return; // previous trace still in flight; its result lands next frame
 	}
 
-	// 1) Trace from eyes forward
 	FVector EyeLoc;
 	FRotator EyeRot;
 	OwnerChar->GetActorEyesViewPoint(EyeLoc, EyeRot);
 
-	const FVector Start = EyeLoc;
-	const FVector End = Start + EyeRot.Vector() * PlaceTraceDistance;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(PlacePreview), false, OwnerChar);
+	if (ActiveHandItem)
+	{
+		Params.AddIgnoredActor(ActiveHandItem);
+	}
 
-	FHitResult Hit;
-	FCollisionQueryParams Params(SCENE_QUERY_STAT(PlaceItem), false, OwnerChar);
+	PlacementTrace = World->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		EyeLoc,
+		EyeLoc + EyeRot.Vector() * PlaceTraceDistance,
+		ECC_Visibility,
+		Params,
+		FCollisionResponseParams::DefaultResponseParam,
+		&PlacementTraceDelegate);
+}
 
-	if (!World->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, Params))
+void USFW_EquipmentManagerComponent::OnPlacementTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	if (Handle != PlacementTrace)
 	{
-		// nothing hit -> invalid placement
 		return;
 	}
+	PlacementTrace = FTraceHandle();
 
-	// 2) Filter to world geometry only (so you can't place on players / items)
-	ECollisionChannel HitChannel = ECC_WorldStatic;
-	if (Hit.Component.IsValid())
+	// Hand changed while the trace was in flight
+	if (!IsComponentTickEnabled() || !OwnerChar)
 	{
-		HitChannel = Hit.Component->GetCollisionObjectType();
+		return;
 	}
 
-	if (HitChannel != ECC_WorldStatic && HitChannel != ECC_WorldDynamic)
+	const FHitResult* Hit = Datum.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
+	if (!Hit)
 	{
-		return; // not ground / level geometry
+		bPlacementValid = false;
+		UpdatePlacementGhost(false);
+		return;
 	}
 
-	// 3) Check surface slope vs world up
-	const FVector Normal = Hit.ImpactNormal.GetSafeNormal();
-	const float DotUp = FVector::DotProduct(Normal, FVector::UpVector);
+	FTransform Xform;
+	PlacementYaw = OwnerChar->GetActorRotation().Yaw;
+	PlacementSurfacePoint = Hit->Location;
+	bPlacementValid = EvaluatePlacementHit(*Hit, PlacementYaw, Xform);
 
-	const float CosMaxSlope =
-		FMath::Cos(FMath::DegreesToRadians(MaxPlaceSlopeDegrees));
+	UpdatePlacementGhost(true);
 
-	if (DotUp < CosMaxSlope)
+	if (PlacementGhost)
 	{
-		// too steep -> e.g. wall, stairs, sharp slope
-		return;
+		PlacementGhost->SetWorldTransform(Xform);
 	}
+}
 
-	// 4) Build final placement transform
-	const FVector PlaceLocation = Hit.Location + Normal * PlaceHeightOffset;
-
-	// Keep item upright in world, yaw aligned to character
-	const FRotator PlaceRot(0.f, OwnerChar->GetActorRotation().Yaw, 0.f);
+void USFW_EquipmentManagerComponent::UpdatePlacementGhost(bool bHasHit)
+{
+	UStaticMesh* GhostMesh = (bHasHit && ActiveHandItem) ? ActiveHandItem->GetPlacementPreviewMesh() : nullptr;
+	if (!GhostMesh)
+	{
+		if (PlacementGhost)
+		{
+			PlacementGhost->SetVisibility(false);
+		}
+		return;
+	}
 
-	FTransform PlaceXform;
-	PlaceXform.SetLocation(PlaceLocation);
-	PlaceXform.SetRotation(PlaceRot.Quaternion());
-	PlaceXform.SetScale3D(FVector::OneVector);
+	if (!PlacementGhost && OwnerChar)
+	{
+		// Local-only scene component on the pawn; never replicated, never collides.
+		PlacementGhost = NewObject<UStaticMeshComponent>(OwnerChar, TEXT("PlacementGhost"));
+		PlacementGhost->SetUsingAbsoluteLocation(true);
+		PlacementGhost->SetUsingAbsoluteRotation(true);
+		PlacementGhost->SetUsingAbsoluteScale(true);
+		PlacementGhost->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+		PlacementGhost->SetCastShadow(false);
+		PlacementGhost->SetMobility(EComponentMobility::Movable);
+		PlacementGhost->RegisterComponent();
+	}
+	if (!PlacementGhost)
+	{
+		return;
+	}
 
-	// 5) Let the item transition into "placed" state
-	// Use whatever you already call here:
-	// - if you made a multicast: ActiveHandItem->Multicast_OnPlaced(PlaceXform);
-	// - if you just had OnPlaced and call it on server then replicate state, do that instead.
-	ActiveHandItem->OnPlaced(PlaceXform);
+	if (PlacementGhost->GetStaticMesh() != GhostMesh)
+	{
+		PlacementGhost->SetStaticMesh(GhostMesh);
+		GhostMaterialState = -1;
+	}
 
-	// 6) Remove from inventory / hand
-	for (int32 i = 0; i < kMaxInventorySlots; ++i)
+	const int8 WantState = bPlacementValid ? 1 : 0;
+	if (GhostMaterialState != WantState)
 	{
-		if (Inventory[i] == ActiveHandItem)
+		if (UMaterialInterface* Mat = bPlacementValid ? PlaceValidMaterial.Get() : PlaceInvalidMaterial.Get())
 		{
-			ClearSlot_Internal(i);
-			break;
+			for (int32 i = 0; i < PlacementGhost->GetNumMaterials(); ++i)
+			{
+				PlacementGhost->SetMaterial(i, Mat);
+			}
 		}
+		GhostMaterialState = WantState;
+	}
+
+	PlacementGhost->SetVisibility(true);
+}
+
+void USFW_EquipmentManagerComponent::PlaceActive()
+{
+	if (!ActiveHandItem || !ActiveHandItem->CanBePlaced() || !bPlacementValid)
+	{
+		return;
+	}
+
+	Server_PlaceActive(PlacementSurfacePoint, PlacementYaw);
+}
+
+void USFW_EquipmentManagerComponent::Server_PlaceActive_Implementation(FVector_NetQuantize10 SurfacePoint, float Yaw)
+{
+	if (!OwnerChar || !ActiveHandItem)
+	{
+		return;
+	}
+
+	// Only allow items that opt into placement (REMPod returns true)
+	if (!ActiveHandItem->CanBePlaced())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	// 1) One eye -> point trace on the preview channel: the point must be in reach,
+	//    nothing may block short of it, and the surface it lands on feeds the same
+	//    normal / slope rules as the client preview.
+	FVector EyeLoc;
+	FRotator EyeRot;
+	OwnerChar->GetActorEyesViewPoint(EyeLoc, EyeRot);
+
+	const FVector ToPoint = FVector(SurfacePoint) - EyeLoc;
+	const double PointDist = ToPoint.Size();
+	if (PointDist < KINDA_SMALL_NUMBER || PointDist > PlaceTraceDistance + PlaceValidateTolerance)
+	{
+		return;
 	}
 
-	ActiveHandItem = nullptr;
-	HeldItem = EHeldItemType::None;
-	Equip = EEquipState::Idle;
+	const FVector Dir = ToPoint / PointDist;
+
+	FHitResult Hit;
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(PlaceItem), false, OwnerChar);
+	Params.AddIgnoredActor(ActiveHandItem);
+
+	if (!World->LineTraceSingleByChannel(Hit, EyeLoc, EyeLoc + Dir * (PointDist + PlaceValidateTolerance), ECC_Visibility, Params)
+		|| Hit.Distance < PointDist - PlaceValidateTolerance)
+	{
+		return;
+	}
+
+	FTransform PlaceXform;
+	if (!EvaluatePlacementHit(Hit, FRotator::NormalizeAxis(Yaw), PlaceXform))
+	{
+		return;
+	}
+
+	// 2) Let the item transition into "placed" state (server + relevant clients)
+	ActiveHandItem->NotifyPlaced(PlaceXform);
+
+	// 3) Remove from inventory / hand
+	ClearSlot_Internal(Inventory.FindSlot(ActiveHandItem));
+
+	SetActiveHandItem_Internal(nullptr);
 
 	ApplyActiveVisuals();
 }
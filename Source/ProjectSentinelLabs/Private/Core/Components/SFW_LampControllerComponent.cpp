@@ -2,6 +2,7 @@
 
 #include "Core/Components/SFW_LampControllerComponent.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "Components/MeshComponent.h"
 #include "Components/LightComponent.h"
 #include "Materials/MaterialInstanceDynamic.h"
@@ -21,12 +22,22 @@ void USFW_LampControllerComponent::BeginPlay()
 	Super::BeginPlay();
 	CreateMIDsIfNeeded();
 	ApplyState();
+
+	// Steady lamps cost nothing to replicate; SetState flushes on change.
+	AActor* Owner = GetOwner();
+	if (Owner && Owner->HasAuthority() && Owner->NetDormancy == DORM_Awake)
+	{
+		Owner->SetNetDormancy(DORM_DormantAll);
+	}
 }
 
 void USFW_LampControllerComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
-	DOREPLIFETIME(USFW_LampControllerComponent, State);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+	DOREPLIFETIME_WITH_PARAMS_FAST(USFW_LampControllerComponent, State, Params);
 }
 
 void USFW_LampControllerComponent::OnRep_State()
@@ -41,13 +52,21 @@ void USFW_LampControllerComponent::SetState(ELampState NewState, float OptionalD
 	//UE_LOG(LogLampCtrl, Log, TEXT("[%s] SetState %d dur=%.2f"),
 		//*GetOwner()->GetName(), (int32)NewState, OptionalDurationSeconds);
 
+	GetOwner()->FlushNetDormancy();
 	State = NewState;
+	MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampControllerComponent, State, this);
 	OnRep_State();
 
 	if (OptionalDurationSeconds > 0.f)
 	{
+		// Timed state: stay awake until the restore lands.
+		GetOwner()->SetNetDormancy(DORM_Awake);
 		StartBlackoutRestoreTimer(OptionalDurationSeconds);
 	}
+	else
+	{
+		GetOwner()->SetNetDormancy(DORM_DormantAll);
+	}
 }
 
 void USFW_LampControllerComponent::StartBlackoutRestoreTimer(float DurationSeconds)
@@ -61,8 +80,13 @@ void USFW_LampControllerComponent::StartBlackoutRestoreTimer(float DurationSecon
 			{
 				if (!GetOwner() || !GetOwner()->HasAuthority()) return;
 				//UE_LOG(LogLampCtrl, Log, TEXT("[%s] Restore -> On"), *GetOwner()->GetName());
+				GetOwner()->FlushNetDormancy();
 				State = ELampState::On;
+				MARK_PROPERTY_DIRTY_FROM_NAME(USFW_LampControllerComponent, State, this);
 				OnRep_State();
+
+				// Back to steady state
+				GetOwner()->SetNetDormancy(DORM_DormantAll);
 			},
 			DurationSeconds, false);
 	}
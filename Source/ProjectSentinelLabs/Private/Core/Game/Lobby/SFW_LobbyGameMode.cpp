@@ -57,7 +57,7 @@ void ASFW_LobbyGameMode::PostLogin(APlayerController* NewPlayer)
 			if (PS->bIsReady) { PS->SetIsReady(false); }
 
 			// --- NEW: hand out catalog & default to Agent A (index 0) ---
-			PS->AgentCatalog = AgentCatalog; // replicates to client
+			PS->SetAgentCatalog(AgentCatalog); // replicates to client
 			if (AgentCatalog && AgentCatalog->Agents.Num() > 0)
 			{
 				// Ensures CharacterIndex wraps & SelectedCharacterID is set on server
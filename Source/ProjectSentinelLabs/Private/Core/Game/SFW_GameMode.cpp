@@ -3,6 +3,7 @@
 
 #include "Core/Game/SFW_GameMode.h"
 #include "Core/AnomalySystems/SFW_AnomalyController.h"
+#include "Core/Actors/SFW_EquippablePoolSubsystem.h"
 #include "Core/Game/SFW_GameState.h"
 #include "Core/Game/SFW_GameInstance.h"
 #include "Core/Game/SFW_PlayerState.h"
@@ -33,8 +34,14 @@ void ASFW_GameMode::StartRound()
 	// Reset state
 	if (ASFW_GameState* GS = GetGameState<ASFW_GameState>())
 	{
-		GS->bRoundActive = true;
-		GS->AnomalyAggression = 0.f;
+		GS->SetRoundActive(true);
+		GS->SetAnomalyAggression(0.f);
+	}
+
+	// Gear spawns up front so the rush at the truck doesn't hitch
+	if (USFW_EquippablePoolSubsystem* Pool = USFW_EquippablePoolSubsystem::Get(this))
+	{
+		Pool->PrewarmFromWorldPickups();
 	}
 
 	// Clean old controller (hot-reload safety)
@@ -76,7 +83,7 @@ void ASFW_GameMode::EndRound(bool bSuccess)
 
 	if (ASFW_GameState* GS = GetGameState<ASFW_GameState>())
 	{
-		GS->bRoundActive = false;
+		GS->SetRoundActive(false);
 	}
 
 	if (IsValid(AnomalyController) && !AnomalyController->IsActorBeingDestroyed())
@@ -85,6 +92,11 @@ void ASFW_GameMode::EndRound(bool bSuccess)
 		AnomalyController = nullptr;
 	}
 
+	if (USFW_EquippablePoolSubsystem* Pool = USFW_EquippablePoolSubsystem::Get(this))
+	{
+		Pool->ReleaseAll();
+	}
+
 	UE_LOG(LogTemp, Warning, TEXT("Round ended. Success=%d"), bSuccess ? 1 : 0);
 }
 
@@ -100,7 +112,7 @@ void ASFW_GameMode::PostLogin(APlayerController* NewPlayer)
 
 	if (ASFW_PlayerState* PS = NewPlayer->GetPlayerState<ASFW_PlayerState>())
 	{
-		PS->AgentCatalog = AgentCatalog;
+		PS->SetAgentCatalog(AgentCatalog);
 
 		if (USFW_GameInstance* GI = GetGameInstance<USFW_GameInstance>())
 		{
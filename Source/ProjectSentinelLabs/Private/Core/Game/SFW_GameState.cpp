@@ -2,8 +2,11 @@
 
 #include "Core/Game/SFW_GameState.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 #include "GameFramework/PlayerState.h"
+#include "Core/Game/SFW_PlayerState.h"
+#include "Core/Rooms/RoomVolume.h"
 #include "PlayerCharacter/SFW_PlayerBase.h"
 #include "Core/Components/SFW_EquipmentManagerComponent.h"
 #include "Core/Actors/SFW_EMFDevice.h"
@@ -42,11 +45,63 @@ void ASFW_GameState::BeginRound(float Now, int32 Seed) {
 	RoundSeed = Seed;
 	RoundEndTime = -1.f;
 	bRoundInProgress = true;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundStartTime, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundSeed, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundEndTime, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bRoundInProgress, this);
 }
 
 void ASFW_GameState::EndRound(float Now) {
 	RoundEndTime = Now;
 	bRoundInProgress = false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundEndTime, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bRoundInProgress, this);
+}
+
+void ASFW_GameState::SetRoundActive(bool bActive)
+{
+	if (!HasAuthority() || bRoundActive == bActive)
+	{
+		return;
+	}
+	bRoundActive = bActive;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bRoundActive, this);
+}
+
+void ASFW_GameState::SetRoundStart(float Now, int32 Seed)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+	RoundStartTime = Now;
+	RoundSeed = Seed;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundStartTime, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoundSeed, this);
+}
+
+void ASFW_GameState::SetAnomalyAggression(float NewAggression)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+	AnomalyAggression = NewAggression;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, AnomalyAggression, this);
+}
+
+void ASFW_GameState::SetRoundRooms(AActor* InBaseRoom, AActor* InRiftRoom)
+{
+	if (!HasAuthority())
+	{
+		return;
+	}
+	BaseRoom = InBaseRoom;
+	RiftRoom = InRiftRoom;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, BaseRoom, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RiftRoom, this);
+
+	RefreshPlayerRoomFlags();
 }
 
 void ASFW_GameState::OnRep_EvidenceWindow()
@@ -65,6 +120,10 @@ void ASFW_GameState::Server_StartEvidenceWindow_Implementation(int32 EvidenceTyp
 	EvidenceWindowStartTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
 	EvidenceWindowDurationSec = FMath::Max(0.f, DurationSec);
 	CurrentEvidenceType = EvidenceType;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bEvidenceWindowActive, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, EvidenceWindowStartTime, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, EvidenceWindowDurationSec, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, CurrentEvidenceType, this);
 
 	UE_LOG(LogTemp, Log, TEXT("[GameState] StartEvidenceWindow type=%d dur=%.2fs"),
 		EvidenceType,
@@ -87,6 +146,7 @@ void ASFW_GameState::Server_EndEvidenceWindow_Implementation()
 	}
 
 	bEvidenceWindowActive = false;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bEvidenceWindowActive, this);
 	UE_LOG(LogTemp, Log, TEXT("[GameState] EndEvidenceWindow"));
 }
 
@@ -129,7 +189,7 @@ void ASFW_GameState::Server_TriggerEvidence_Implementation(int32 EvidenceType)
 			if (EMF)
 			{
 				UE_LOG(LogTemp, Log, TEXT("[GameState] Triggering EMF spike on %s"), *EMF->GetName());
-				EMF->Server_SetActive(true);
+				EMF->SetActive(true);
 			}
 		}
 
@@ -149,6 +209,7 @@ void ASFW_GameState::ConsumeBinderDoorScare()
 	if (BinderDoorScareBudget > 0)
 	{
 		BinderDoorScareBudget--;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, BinderDoorScareBudget, this);
 	}
 }
 
@@ -158,6 +219,7 @@ void ASFW_GameState::Server_SetRadioJammed(bool bJammed)
 	if (HasAuthority())
 	{
 		bRadioJammed = bJammed;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bRadioJammed, this);
 	}
 }
 
@@ -166,13 +228,268 @@ void ASFW_GameState::Server_SetRadioIntegrity(float NewIntegrity)
 	if (HasAuthority())
 	{
 		RadioIntegrity = FMath::Clamp(NewIntegrity, 0.0f, 1.0f);
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RadioIntegrity, this);
 
 		// simple rule. if integrity is almost dead then jam
 		if (RadioIntegrity <= 0.1f)
 		{
 			bRadioJammed = true;
+			MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, bRadioJammed, this);
+		}
+	}
+}
+
+// ------------------------
+// Room occupancy
+// ------------------------
+int32 ASFW_GameState::GetOccupancySlot(const APlayerState* PS)
+{
+	const ASFW_PlayerState* SFWPS = Cast<ASFW_PlayerState>(PS);
+	return SFWPS ? SFWPS->OccupancySlot : INDEX_NONE;
+}
+
+void ASFW_GameState::OnRep_RoomOccupancy()
+{
+	RefreshPlayerRoomFlags();
+	OnRoomOccupancyChanged.Broadcast();
+}
+
+void ASFW_GameState::RefreshPlayerRoomFlags()
+{
+	for (APlayerState* Generic : PlayerArray)
+	{
+		if (ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(Generic))
+		{
+			PS->RefreshRoomFlags();
+		}
+	}
+}
+
+int32 ASFW_GameState::RegisterRoom(FName RoomId, bool bSafe)
+{
+	if (!HasAuthority() || RoomId.IsNone())
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 Existing = FindRoomIndex(RoomId);
+	if (Existing != INDEX_NONE)
+	{
+		if (bSafe && !RoomIsSafe[Existing])
+		{
+			RoomIsSafe[Existing] = true;
+			MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomIsSafe, this);
+		}
+		return Existing;
+	}
+
+	const int32 NewIndex = RoomIndexIds.Add(RoomId);
+	RoomOccupancy.Add(0u);
+	RoomIsSafe.Add(bSafe);
+	RoomOccupancyRefs.AddZeroed(MaxOccupancySlots);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomIndexIds, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomOccupancy, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomIsSafe, this);
+
+	UE_LOG(LogTemp, Verbose, TEXT("[GameState] RegisterRoom %s -> %d"), *RoomId.ToString(), NewIndex);
+	return NewIndex;
+}
+
+void ASFW_GameState::AddRoomOccupant(int32 RoomIndex, int32 Slot)
+{
+	if (!HasAuthority() || !RoomOccupancy.IsValidIndex(RoomIndex) || Slot < 0 || Slot >= MaxOccupancySlots)
+	{
+		return;
+	}
+
+	uint8& Refs = RoomOccupancyRefs[RoomIndex * MaxOccupancySlots + Slot];
+	if (Refs++ > 0)
+	{
+		return; // already flagged by another volume of this room
+	}
+
+	RoomOccupancy[RoomIndex] |= (1u << Slot);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomOccupancy, this);
+	OnRep_RoomOccupancy();
+}
+
+void ASFW_GameState::RemoveRoomOccupant(int32 RoomIndex, int32 Slot)
+{
+	if (!HasAuthority() || !RoomOccupancy.IsValidIndex(RoomIndex) || Slot < 0 || Slot >= MaxOccupancySlots)
+	{
+		return;
+	}
+
+	uint8& Refs = RoomOccupancyRefs[RoomIndex * MaxOccupancySlots + Slot];
+	if (Refs == 0 || --Refs > 0)
+	{
+		return;
+	}
+
+	RoomOccupancy[RoomIndex] &= ~(1u << Slot);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomOccupancy, this);
+	OnRep_RoomOccupancy();
+}
+
+bool ASFW_GameState::IsPlayerInRoom(const APlayerState* PS, FName RoomId) const
+{
+	const int32 Slot = GetOccupancySlot(PS);
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+	return (GetRoomOccupancyMask(FindRoomIndex(RoomId)) & (1u << Slot)) != 0u;
+}
+
+bool ASFW_GameState::IsPlayerInSafeRoom(const APlayerState* PS) const
+{
+	const int32 Slot = GetOccupancySlot(PS);
+	if (Slot == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const uint32 Bit = 1u << Slot;
+	const int32 Num = FMath::Min(RoomOccupancy.Num(), RoomIsSafe.Num());
+	for (int32 i = 0; i < Num; ++i)
+	{
+		if (RoomIsSafe[i] && (RoomOccupancy[i] & Bit))
+		{
+			return true;
 		}
 	}
+	return false;
+}
+
+bool ASFW_GameState::IsPlayerInRiftRoom(const APlayerState* PS) const
+{
+	const int32 Slot = GetOccupancySlot(PS);
+	const ARoomVolume* Rift = Cast<ARoomVolume>(RiftRoom);
+	if (Slot == INDEX_NONE || !Rift)
+	{
+		return false;
+	}
+	return (GetRoomOccupancyMask(Rift->GetRoomIndex()) & (1u << Slot)) != 0u;
+}
+
+FName ASFW_GameState::GetRoomOfPlayer(const APlayerState* PS) const
+{
+	const int32 Slot = GetOccupancySlot(PS);
+	if (Slot == INDEX_NONE)
+	{
+		return NAME_None;
+	}
+
+	const uint32 Bit = 1u << Slot;
+	for (int32 i = 0; i < RoomOccupancy.Num(); ++i)
+	{
+		if ((RoomOccupancy[i] & Bit) && RoomIndexIds.IsValidIndex(i))
+		{
+			return RoomIndexIds[i];
+		}
+	}
+	return NAME_None;
+}
+
+void ASFW_GameState::GetPlayersInRoom(FName RoomId, TArray<APlayerState*>& OutPlayers) const
+{
+	OutPlayers.Reset();
+
+	const uint32 Mask = GetRoomOccupancyMask(FindRoomIndex(RoomId));
+	if (Mask == 0u)
+	{
+		return;
+	}
+
+	for (APlayerState* PS : PlayerArray)
+	{
+		const int32 Slot = GetOccupancySlot(PS);
+		if (Slot != INDEX_NONE && (Mask & (1u << Slot)))
+		{
+			OutPlayers.Add(PS);
+		}
+	}
+}
+
+void ASFW_GameState::GetOccupiedRoomIds(TArray<FName>& OutRoomIds) const
+{
+	OutRoomIds.Reset();
+	for (int32 i = 0; i < RoomOccupancy.Num(); ++i)
+	{
+		if (RoomOccupancy[i] != 0u && RoomIndexIds.IsValidIndex(i))
+		{
+			OutRoomIds.Add(RoomIndexIds[i]);
+		}
+	}
+}
+
+void ASFW_GameState::AddPlayerState(APlayerState* PlayerState)
+{
+	Super::AddPlayerState(PlayerState);
+
+	if (!HasAuthority())
+	{
+		return;
+	}
+
+	ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(PlayerState);
+	if (!PS || PS->OccupancySlot != INDEX_NONE)
+	{
+		return;
+	}
+
+	// lowest free bit
+	const uint32 Free = ~UsedOccupancySlots;
+	if (Free == 0u)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[GameState] No free occupancy slot for %s (max %d players)."),
+			*GetNameSafe(PS), MaxOccupancySlots);
+		return;
+	}
+
+	const int32 Slot = static_cast<int32>(FMath::CountTrailingZeros(Free));
+	UsedOccupancySlots |= (1u << Slot);
+	PS->SetOccupancySlot(Slot);
+}
+
+void ASFW_GameState::RemovePlayerState(APlayerState* PlayerState)
+{
+	if (HasAuthority())
+	{
+		if (ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(PlayerState))
+		{
+			const int32 Slot = PS->OccupancySlot;
+			if (Slot != INDEX_NONE)
+			{
+				// Drop the player from every room so the bit can be reused.
+				const uint32 Bit = 1u << Slot;
+				bool bChanged = false;
+				for (int32 i = 0; i < RoomOccupancy.Num(); ++i)
+				{
+					RoomOccupancyRefs[i * MaxOccupancySlots + Slot] = 0;
+					if (RoomOccupancy[i] & Bit)
+					{
+						RoomOccupancy[i] &= ~Bit;
+						bChanged = true;
+					}
+				}
+
+				UsedOccupancySlots &= ~Bit;
+				PS->SetOccupancySlot(INDEX_NONE);
+
+				// Volumes still holding the old pawn must not decrement the reused slot on its EndOverlap
+				OnOccupancySlotReleased.Broadcast(Slot);
+
+				if (bChanged)
+				{
+					MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_GameState, RoomOccupancy, this);
+					OnRep_RoomOccupancy();
+				}
+			}
+		}
+	}
+
+	Super::RemovePlayerState(PlayerState);
 }
 
 // replication
@@ -180,20 +497,28 @@ void ASFW_GameState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLi
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ASFW_GameState, bRoundActive);
-	DOREPLIFETIME(ASFW_GameState, RoundSeed);
-	DOREPLIFETIME(ASFW_GameState, RoundStartTime);
-	DOREPLIFETIME(ASFW_GameState, RoundEndTime);   
-
-	DOREPLIFETIME(ASFW_GameState, AnomalyAggression);
-	DOREPLIFETIME(ASFW_GameState, ActiveClass);
-	DOREPLIFETIME(ASFW_GameState, BaseRoom);
-	DOREPLIFETIME(ASFW_GameState, RiftRoom);
-	DOREPLIFETIME(ASFW_GameState, bEvidenceWindowActive);
-	DOREPLIFETIME(ASFW_GameState, EvidenceWindowStartTime);
-	DOREPLIFETIME(ASFW_GameState, EvidenceWindowDurationSec);
-	DOREPLIFETIME(ASFW_GameState, CurrentEvidenceType);
-	DOREPLIFETIME(ASFW_GameState, BinderDoorScareBudget);
-	DOREPLIFETIME(ASFW_GameState, bRadioJammed);
-	DOREPLIFETIME(ASFW_GameState, RadioIntegrity);
+	// Push model: writes mark themselves dirty; nothing here is compared per net update.
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, bRoundActive, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoundSeed, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoundStartTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoundEndTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, bRoundInProgress, Params);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, AnomalyAggression, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, ActiveClass, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, BaseRoom, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RiftRoom, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoomIndexIds, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoomOccupancy, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RoomIsSafe, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, bEvidenceWindowActive, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, EvidenceWindowStartTime, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, EvidenceWindowDurationSec, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, CurrentEvidenceType, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, BinderDoorScareBudget, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, bRadioJammed, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_GameState, RadioIntegrity, Params);
 }
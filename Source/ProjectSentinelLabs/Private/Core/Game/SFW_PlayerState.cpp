@@ -2,12 +2,11 @@
 
 
 #include "Core/Game/SFW_PlayerState.h"
+#include "Core/Game/SFW_GameState.h"
 #include "Net/UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "PlayerCharacter/Data/SFW_AgentCatalog.h"
 #include "Engine/World.h"
-#include "TimerManager.h"
-#include "EngineUtils.h"
-#include "GameFramework/Pawn.h"
 
 ASFW_PlayerState::ASFW_PlayerState() {}
 
@@ -15,41 +14,37 @@ void ASFW_PlayerState::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(ASFW_PlayerState, SelectedCharacterID);
-	DOREPLIFETIME(ASFW_PlayerState, SelectedVariantID);
-	DOREPLIFETIME(ASFW_PlayerState, bIsReady);
-	DOREPLIFETIME(ASFW_PlayerState, bIsHost);
+	// Push model: every write goes through MARK_PROPERTY_DIRTY_FROM_NAME below.
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
 
-	DOREPLIFETIME(ASFW_PlayerState, AgentCatalog);
-	DOREPLIFETIME(ASFW_PlayerState, CharacterIndex);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, SelectedCharacterID, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, SelectedVariantID, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, bIsReady, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, bIsHost, Params);
 
-	DOREPLIFETIME(ASFW_PlayerState, Sanity);
-	DOREPLIFETIME(ASFW_PlayerState, SanityTier);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, AgentCatalog, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, CharacterIndex, Params);
 
-	DOREPLIFETIME(ASFW_PlayerState, bInRiftRoom);
-	DOREPLIFETIME(ASFW_PlayerState, bIsBlackedOut);
-	DOREPLIFETIME(ASFW_PlayerState, BlackoutEndTime);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, SanityTier, Params);
 
-	DOREPLIFETIME(ASFW_PlayerState, bInSafeRoom);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, bIsBlackedOut, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, BlackoutEndTime, Params);
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, OccupancySlot, Params);
+
+	Params.Condition = COND_OwnerOnly;
+	DOREPLIFETIME_WITH_PARAMS_FAST(ASFW_PlayerState, SanityNet, Params);
 }
 
 void ASFW_PlayerState::BeginPlay()
 {
 	Super::BeginPlay();
-
-	if (HasAuthority())
-	{
-		// 1 Hz server-side drift
-		GetWorldTimerManager().SetTimer(SanityTickHandle, this, &ASFW_PlayerState::SanityTick, 1.0f, true, 1.0f);
-	}
+	// Passive sanity drift is driven for all players by USFW_SanitySubsystem.
 }
 
 void ASFW_PlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-	if (HasAuthority())
-	{
-		GetWorldTimerManager().ClearTimer(SanityTickHandle);
-	}
 	Super::EndPlay(EndPlayReason);
 }
 
@@ -61,11 +56,13 @@ void ASFW_PlayerState::SetSelectedCharacterAndVariant(const FName& InCharacterID
 	if (SelectedCharacterID != InCharacterID)
 	{
 		SelectedCharacterID = InCharacterID;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SelectedCharacterID, this);
 		OnRep_SelectedCharacterID();
 	}
 	if (SelectedVariantID != InVariantID)
 	{
 		SelectedVariantID = InVariantID;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SelectedVariantID, this);
 		OnRep_SelectedVariantID();
 	}
 }
@@ -75,6 +72,7 @@ void ASFW_PlayerState::SetIsReady(bool bNewReady)
 	if (!HasAuthority()) return;
 	if (bIsReady == bNewReady) return;
 	bIsReady = bNewReady;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, bIsReady, this);
 	OnRep_IsReady();
 }
 
@@ -84,6 +82,7 @@ void ASFW_PlayerState::ResetForLobby()
 	if (bIsReady)
 	{
 		bIsReady = false;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, bIsReady, this);
 		OnRep_IsReady();
 	}
 }
@@ -93,6 +92,7 @@ void ASFW_PlayerState::ServerSetIsHost(bool bNewIsHost)
 	check(HasAuthority());
 	if (bIsHost == bNewIsHost) return;
 	bIsHost = bNewIsHost;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, bIsHost, this);
 	OnRep_IsHost();
 }
 
@@ -117,7 +117,8 @@ void ASFW_PlayerState::ApplySanityDelta(float Delta)
 	Sanity = FMath::Clamp(Old + Delta, 0.f, 100.f);
 	if (!FMath::IsNearlyEqual(Old, Sanity))
 	{
-		OnRep_Sanity();
+		NotifySanityChanged();
+		UpdateSanityNet();
 		RecomputeAndApplySanityTier();
 	}
 }
@@ -130,17 +131,57 @@ void ASFW_PlayerState::SetSanity(float NewValue)
 	Sanity = FMath::Clamp(NewValue, 0.f, 100.f);
 	if (!FMath::IsNearlyEqual(Old, Sanity))
 	{
-		OnRep_Sanity();
+		NotifySanityChanged();
+		UpdateSanityNet();
 		RecomputeAndApplySanityTier();
 	}
 }
 
-void ASFW_PlayerState::SetInRiftRoom(bool bIn)
+void ASFW_PlayerState::SetSanityRate(float PerSec)
 {
 	if (!HasAuthority()) return;
-	if (bInRiftRoom == bIn) return;
-	bInRiftRoom = bIn;
-	OnRep_InRiftRoom();
+	SanityRate = PerSec;
+	UpdateSanityNet();
+}
+
+void ASFW_PlayerState::UpdateSanityNet()
+{
+	check(HasAuthority());
+
+	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	const int16 NewRate = (int16)FMath::Clamp(FMath::RoundToInt(SanityRate * 1000.f), (int32)MIN_int16, (int32)MAX_int16);
+
+	// What the owner is currently showing
+	const float Predicted = FMath::Clamp(
+		SanityNet.Value / 100.f + (SanityNet.RatePerSec / 1000.f) * (Now - SanityNetTime), 0.f, 100.f);
+
+	if (NewRate == SanityNet.RatePerSec && FMath::Abs(Predicted - Sanity) <= SanityNetTolerance)
+	{
+		return;
+	}
+
+	SanityNet.Value = (uint16)FMath::Clamp(FMath::RoundToInt(Sanity * 100.f), 0, 10000);
+	SanityNet.RatePerSec = NewRate;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SanityNet, this);
+	SanityNetTime = Now;
+}
+
+float ASFW_PlayerState::GetDisplaySanity() const
+{
+	if (HasAuthority())
+	{
+		return Sanity;
+	}
+
+	const float Now = GetWorld() ? GetWorld()->GetTimeSeconds() : SanityNetTime;
+	return FMath::Clamp(Sanity + (SanityNet.RatePerSec / 1000.f) * (Now - SanityNetTime), 0.f, 100.f);
+}
+
+void ASFW_PlayerState::OnRep_SanityNet()
+{
+	Sanity = SanityNet.Value / 100.f;
+	SanityNetTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.f;
+	NotifySanityChanged();
 }
 
 void ASFW_PlayerState::StartBlackout(float DurationSeconds)
@@ -148,6 +189,8 @@ void ASFW_PlayerState::StartBlackout(float DurationSeconds)
 	if (!HasAuthority()) return;
 	bIsBlackedOut = true;
 	BlackoutEndTime = GetWorld() ? GetWorld()->GetTimeSeconds() + FMath::Max(0.f, DurationSeconds) : 0.f;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, bIsBlackedOut, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, BlackoutEndTime, this);
 	OnRep_Blackout();
 }
 
@@ -157,22 +200,48 @@ void ASFW_PlayerState::ClearBlackout()
 	if (!bIsBlackedOut) return;
 	bIsBlackedOut = false;
 	BlackoutEndTime = 0.f;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, bIsBlackedOut, this);
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, BlackoutEndTime, this);
 	OnRep_Blackout();
 }
 
-void ASFW_PlayerState::SetInSafeRoom(bool bIn)
+void ASFW_PlayerState::RefreshRoomFlags()
 {
-	if (!HasAuthority()) return;
-	if (bInSafeRoom == bIn) return;
-	bInSafeRoom = bIn;
-	OnRep_SafeRoom();
+	const ASFW_GameState* GS = GetWorld() ? GetWorld()->GetGameState<ASFW_GameState>() : nullptr;
+	if (!GS) return;
+
+	const bool bRift = GS->IsPlayerInRiftRoom(this);
+	if (bInRiftRoom != bRift)
+	{
+		bInRiftRoom = bRift;
+		OnInRiftChanged.Broadcast(bInRiftRoom);
+	}
+
+	const bool bSafe = GS->IsPlayerInSafeRoom(this);
+	if (bInSafeRoom != bSafe)
+	{
+		bInSafeRoom = bSafe;
+		OnSafeRoomChanged.Broadcast();
+	}
 }
 
-void ASFW_PlayerState::OnRep_Sanity() { OnSanityChanged.Broadcast(Sanity); }
+void ASFW_PlayerState::NotifySanityChanged() { OnSanityChanged.Broadcast(Sanity); }
 void ASFW_PlayerState::OnRep_SanityTier() { OnSanityTierChanged.Broadcast(SanityTier); }
-void ASFW_PlayerState::OnRep_InRiftRoom() { OnInRiftChanged.Broadcast(bInRiftRoom); }
 void ASFW_PlayerState::OnRep_Blackout() { OnBlackoutChanged.Broadcast(bIsBlackedOut); }
-void ASFW_PlayerState::OnRep_SafeRoom() { OnSafeRoomChanged.Broadcast(); }
+
+void ASFW_PlayerState::SetAgentCatalog(USFW_AgentCatalog* InCatalog)
+{
+	if (!HasAuthority()) return;
+	AgentCatalog = InCatalog;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, AgentCatalog, this);
+}
+
+void ASFW_PlayerState::SetOccupancySlot(int32 InSlot)
+{
+	if (!HasAuthority()) return;
+	OccupancySlot = InSlot;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, OccupancySlot, this);
+}
 
 // ---------- Helpers & RPCs ----------
 int32 ASFW_PlayerState::GetAgentCount() const
@@ -183,8 +252,8 @@ int32 ASFW_PlayerState::GetAgentCount() const
 void ASFW_PlayerState::NormalizeIndex()
 {
 	const int32 Count = GetAgentCount();
-	if (Count <= 0) { CharacterIndex = 0; return; }
-	CharacterIndex = (CharacterIndex % Count + Count) % Count;
+	CharacterIndex = Count > 0 ? (CharacterIndex % Count + Count) % Count : 0;
+	MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, CharacterIndex, this);
 }
 
 void ASFW_PlayerState::ApplyIndexToSelectedID()
@@ -198,6 +267,7 @@ void ASFW_PlayerState::ApplyIndexToSelectedID()
 	if (SelectedCharacterID != NewID)
 	{
 		SelectedCharacterID = NewID;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SelectedCharacterID, this);
 		OnRep_SelectedCharacterID();
 	}
 }
@@ -238,6 +308,7 @@ void ASFW_PlayerState::ServerSetCharacterByID_Implementation(FName InCharacterID
 	if (Found != INDEX_NONE)
 	{
 		CharacterIndex = Found;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, CharacterIndex, this);
 		ApplyIndexToSelectedID();
 		return;
 	}
@@ -245,6 +316,7 @@ void ASFW_PlayerState::ServerSetCharacterByID_Implementation(FName InCharacterID
 	if (SelectedCharacterID != InCharacterID)
 	{
 		SelectedCharacterID = InCharacterID;
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SelectedCharacterID, this);
 		OnRep_SelectedCharacterID();
 	}
 }
@@ -279,60 +351,7 @@ void ASFW_PlayerState::RecomputeAndApplySanityTier()
 	if (NewTier != SanityTier)
 	{
 		SanityTier = NewTier;   // replicated
+		MARK_PROPERTY_DIRTY_FROM_NAME(ASFW_PlayerState, SanityTier, this);
 		OnRep_SanityTier();     // fire locally on server
 	}
 }
-
-// ---------- Passive drift (server) ----------
-void ASFW_PlayerState::SanityTick()
-{
-	if (!HasAuthority() || bIsBlackedOut) return;
-
-	const float CeilValue = 100.f * FMath::Clamp(RecoveryCeilPct, 0.f, 1.f);
-	float Delta = 0.f;
-
-	if (bInSafeRoom)
-	{
-		if (Sanity < CeilValue)
-		{
-			Delta = SafeRoomRecoveryPerSec;
-			if (Sanity + Delta > CeilValue) Delta = CeilValue - Sanity;
-		}
-	}
-	else
-	{
-		Delta = -BaseDrainPerSec;
-
-		// amplify drain near Shade
-		if (Delta < 0.f && ShadeClass)
-		{
-			UWorld* W = GetWorld();
-			APawn* MyPawn = nullptr;
-
-			// find my pawn
-			for (TActorIterator<APawn> ItPawn(W); ItPawn; ++ItPawn)
-			{
-				if (ItPawn->GetPlayerState() == this) { MyPawn = *ItPawn; break; }
-			}
-
-			if (MyPawn)
-			{
-				const float R2 = ShadeRadius * ShadeRadius;
-				for (TActorIterator<AActor> ItShade(W, ShadeClass); ItShade; ++ItShade)
-				{
-					AActor* Shade = *ItShade;
-					if (FVector::DistSquared(Shade->GetActorLocation(), MyPawn->GetActorLocation()) <= R2)
-					{
-						Delta *= ShadeDrainMultiplier; // e.g. 2.5
-						break;
-					}
-				}
-			}
-		}
-	}
-
-	if (!FMath::IsNearlyZero(Delta))
-	{
-		ApplySanityDelta(Delta);
-	}
-}
@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Game/SFW_SanitySubsystem.h"
+#include "Core/Game/SFW_PlayerState.h"
+#include "Core/Game/SFW_GameState.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "TimerManager.h"
+
+bool USFW_SanitySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_SanitySubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Server-driven only; clients get the replicated result.
+	if (InWorld.GetNetMode() == NM_Client)
+	{
+		return;
+	}
+
+	InWorld.GetTimerManager().SetTimer(TickHandle, this, &USFW_SanitySubsystem::SanityTick, TickInterval, true, TickInterval);
+}
+
+void USFW_SanitySubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(TickHandle);
+	}
+	Super::Deinitialize();
+}
+
+void USFW_SanitySubsystem::SanityTick()
+{
+	UWorld* World = GetWorld();
+	const ASFW_GameState* GS = World ? World->GetGameState<ASFW_GameState>() : nullptr;
+	if (!GS) return;
+
+	// ---------- Shade positions, once per distinct class ----------
+	ShadeClassRanges.Reset();
+	ShadePositions.Reset();
+
+	for (APlayerState* Generic : GS->PlayerArray)
+	{
+		const ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(Generic);
+		UClass* ShadeClass = PS ? PS->ShadeClass.Get() : nullptr;
+		if (!ShadeClass || ShadeClassRanges.ContainsByPredicate([ShadeClass](const TPair<UClass*, int32>& P) { return P.Key == ShadeClass; }))
+		{
+			continue;
+		}
+
+		ShadeClassRanges.Emplace(ShadeClass, ShadePositions.Num());
+		for (TActorIterator<AActor> It(World, ShadeClass); It; ++It)
+		{
+			ShadePositions.Add(It->GetActorLocation());
+		}
+	}
+
+	// ---------- One pass over players ----------
+	for (APlayerState* Generic : GS->PlayerArray)
+	{
+		ASFW_PlayerState* PS = Cast<ASFW_PlayerState>(Generic);
+		if (!PS) continue;
+
+		if (PS->bIsBlackedOut)
+		{
+			PS->SetSanityRate(0.f);
+			continue;
+		}
+
+		TConstArrayView<FVector> Shades;
+		for (int32 i = 0; i < ShadeClassRanges.Num(); ++i)
+		{
+			if (ShadeClassRanges[i].Key == PS->ShadeClass.Get())
+			{
+				const int32 Begin = ShadeClassRanges[i].Value;
+				const int32 End = ShadeClassRanges.IsValidIndex(i + 1) ? ShadeClassRanges[i + 1].Value : ShadePositions.Num();
+				Shades = MakeArrayView(ShadePositions.GetData() + Begin, End - Begin);
+				break;
+			}
+		}
+
+		const float Delta = ComputeDelta(PS, GS->IsPlayerInSafeRoom(PS), Shades);
+
+		// Rate first so the owner's extrapolation lines up with the new value.
+		PS->SetSanityRate(Delta / TickInterval);
+		if (!FMath::IsNearlyZero(Delta))
+		{
+			PS->ApplySanityDelta(Delta);
+		}
+	}
+}
+
+float USFW_SanitySubsystem::ComputeDelta(const ASFW_PlayerState* PS, bool bInSafeRoom, TConstArrayView<FVector> Shades) const
+{
+	const float Sanity = PS->Sanity;
+
+	if (bInSafeRoom)
+	{
+		const float CeilValue = 100.f * FMath::Clamp(PS->RecoveryCeilPct, 0.f, 1.f);
+		if (Sanity >= CeilValue) return 0.f;
+		return FMath::Min(PS->SafeRoomRecoveryPerSec * TickInterval, CeilValue - Sanity);
+	}
+
+	float Delta = -PS->BaseDrainPerSec * TickInterval;
+
+	// amplify drain near Shade
+	if (Delta < 0.f && Shades.Num() > 0)
+	{
+		if (const APawn* MyPawn = PS->GetPawn())
+		{
+			const FVector Me = MyPawn->GetActorLocation();
+			const float R2 = PS->ShadeRadius * PS->ShadeRadius;
+			for (const FVector& Shade : Shades)
+			{
+				if (FVector::DistSquared(Shade, Me) <= R2)
+				{
+					Delta *= PS->ShadeDrainMultiplier;
+					break;
+				}
+			}
+		}
+	}
+
+	return Delta;
+}
@@ -0,0 +1,399 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Interact/SFW_InteractableSubsystem.h"
+
+#include "Core/Actors/Interface/SFW_InteractableInterface.h"
+#include "Core/Actors/SFW_EquippableBase.h"
+
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+USFW_InteractableSubsystem* USFW_InteractableSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_InteractableSubsystem>() : nullptr;
+}
+
+bool USFW_InteractableSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_InteractableSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (UWorld* World = GetWorld())
+	{
+		SpawnedHandle = World->AddOnActorSpawnedHandler(
+			FOnActorSpawned::FDelegate::CreateUObject(this, &USFW_InteractableSubsystem::Register));
+		DestroyedHandle = World->AddOnActorDestroyedHandler(
+			FOnActorDestroyed::FDelegate::CreateUObject(this, &USFW_InteractableSubsystem::Unregister));
+	}
+}
+
+void USFW_InteractableSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Level-placed actors never go through the spawn handler
+	for (TActorIterator<AActor> It(&InWorld); It; ++It)
+	{
+		Register(*It);
+	}
+}
+
+void USFW_InteractableSubsystem::Deinitialize()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->RemoveOnActorSpawnedHandler(SpawnedHandle);
+		World->RemoveOnActorDestroyedHandler(DestroyedHandle);
+	}
+
+	Cells.Reset();
+	StaticCell.Reset();
+	Dynamic.Reset();
+	InterfaceSupport.Reset();
+	ValidationCache.Reset();
+	PendingLOS.Reset();
+	Super::Deinitialize();
+}
+
+// ---------- Classification ----------
+
+bool USFW_InteractableSubsystem::SupportsInteract(const UClass* Class) const
+{
+	if (!Class)
+	{
+		return false;
+	}
+
+	if (const bool* Cached = InterfaceSupport.Find(Class))
+	{
+		return *Cached;
+	}
+
+	const bool bSupports = Class->ImplementsInterface(USFW_InteractableInterface::StaticClass());
+	InterfaceSupport.Add(Class, bSupports);
+	return bSupports;
+}
+
+bool USFW_InteractableSubsystem::IsInteractable(const AActor* Actor) const
+{
+	return IsValid(Actor) && SupportsInteract(Actor->GetClass());
+}
+
+bool USFW_InteractableSubsystem::IsDynamic(const AActor* Actor)
+{
+	return Actor->IsA<ASFW_EquippableBase>() || Actor->IsReplicatingMovement();
+}
+
+bool USFW_InteractableSubsystem::IsQueryable(const AActor* Actor)
+{
+	// Held / stowed / pooled items are not in the world
+	return IsValid(Actor) && !Actor->IsHidden() && !Cast<APawn>(Actor->GetAttachParentActor());
+}
+
+FVector USFW_InteractableSubsystem::ComputeFocusPoint(const AActor* Actor, float& OutRadius)
+{
+	FVector Origin, Extent;
+	Actor->GetActorBounds(/*bOnlyCollidingComponents*/ true, Origin, Extent);
+	if (Extent.IsNearlyZero())
+	{
+		OutRadius = 0.f;
+		return Actor->GetActorLocation();
+	}
+
+	OutRadius = Extent.Size();
+	return Origin;
+}
+
+FIntVector USFW_InteractableSubsystem::CellFor(const FVector& P) const
+{
+	return FIntVector(
+		FMath::FloorToInt(P.X / CellSize),
+		FMath::FloorToInt(P.Y / CellSize),
+		FMath::FloorToInt(P.Z / CellSize));
+}
+
+// ---------- Registration ----------
+
+void USFW_InteractableSubsystem::Register(AActor* Actor)
+{
+	if (!IsInteractable(Actor))
+	{
+		return;
+	}
+
+	if (IsDynamic(Actor))
+	{
+		Dynamic.AddUnique(Actor);
+		return;
+	}
+
+	if (StaticCell.Contains(Actor))
+	{
+		return;
+	}
+
+	FStaticEntry Entry;
+	Entry.Actor = Actor;
+	Entry.FocusPoint = ComputeFocusPoint(Actor, Entry.Radius);
+
+	const FIntVector Cell = CellFor(Entry.FocusPoint);
+	Cells.FindOrAdd(Cell).Add(Entry);
+	StaticCell.Add(Actor, Cell);
+}
+
+void USFW_InteractableSubsystem::Unregister(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	FIntVector Cell;
+	if (StaticCell.RemoveAndCopyValue(Actor, Cell))
+	{
+		if (TArray<FStaticEntry>* Entries = Cells.Find(Cell))
+		{
+			Entries->RemoveAllSwap([Actor](const FStaticEntry& E) { return E.Actor.Get() == Actor; }, EAllowShrinking::No);
+			if (Entries->Num() == 0)
+			{
+				Cells.Remove(Cell);
+			}
+		}
+		return;
+	}
+
+	Dynamic.RemoveSwap(Actor, EAllowShrinking::No);
+}
+
+// ---------- Queries ----------
+
+template <typename VisitorType>
+void USFW_InteractableSubsystem::ForEachInRange(const FVector& Center, float Radius, VisitorType&& Visitor) const
+{
+	const float RadiusSq = FMath::Square(Radius);
+
+	const FIntVector Lo = CellFor(Center - FVector(Radius));
+	const FIntVector Hi = CellFor(Center + FVector(Radius));
+
+	for (int32 X = Lo.X; X <= Hi.X; ++X)
+	{
+		for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+		{
+			for (int32 Z = Lo.Z; Z <= Hi.Z; ++Z)
+			{
+				const TArray<FStaticEntry>* Entries = Cells.Find(FIntVector(X, Y, Z));
+				if (!Entries)
+				{
+					continue;
+				}
+
+				for (const FStaticEntry& Entry : *Entries)
+				{
+					AActor* Actor = Entry.Actor.Get();
+					if (FVector::DistSquared(Center, Entry.FocusPoint) <= RadiusSq && IsQueryable(Actor))
+					{
+						if (!Visitor(Actor, Entry.FocusPoint, Entry.Radius))
+						{
+							return;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& Weak : Dynamic)
+	{
+		AActor* Actor = Weak.Get();
+		if (!IsQueryable(Actor))
+		{
+			continue;
+		}
+
+		float BoundsRadius = 0.f;
+		const FVector FocusPoint = ComputeFocusPoint(Actor, BoundsRadius);
+		if (FVector::DistSquared(Center, FocusPoint) <= RadiusSq)
+		{
+			if (!Visitor(Actor, FocusPoint, BoundsRadius))
+			{
+				return;
+			}
+		}
+	}
+}
+
+void USFW_InteractableSubsystem::GatherInRange(const FVector& Center, float Radius, TArray<FSFWInteractableCandidate>& OutCandidates) const
+{
+	ForEachInRange(Center, Radius, [&OutCandidates](AActor* Actor, const FVector& FocusPoint, float BoundsRadius)
+	{
+		FSFWInteractableCandidate& C = OutCandidates.AddDefaulted_GetRef();
+		C.Actor = Actor;
+		C.FocusPoint = FocusPoint;
+		C.Radius = BoundsRadius;
+		return true;
+	});
+}
+
+bool USFW_InteractableSubsystem::AnyInRange(const FVector& Center, float Radius) const
+{
+	bool bFound = false;
+	ForEachInRange(Center, Radius, [&bFound](AActor*, const FVector&, float)
+	{
+		bFound = true;
+		return false;
+	});
+	return bFound;
+}
+
+// ---------- Server validation ----------
+
+bool USFW_InteractableSubsystem::PassesRangeCheck(const APlayerController* PC, const AActor* Target, float MaxRange)
+{
+	const APawn* Pawn = PC ? PC->GetPawn() : nullptr;
+	if (!Pawn || !IsValid(Target))
+	{
+		return false;
+	}
+
+	// Pawn to target origin, with some slack over the client's eye-to-focus range
+	return FVector::DistSquared(Pawn->GetActorLocation(), Target->GetActorLocation()) <= FMath::Square(MaxRange + 30.f);
+}
+
+bool USFW_InteractableSubsystem::CanInteractNow(const APlayerController* PC, const AActor* Target, float MaxRange) const
+{
+	return IsInteractable(Target) && IsQueryable(Target) && PassesRangeCheck(PC, Target, MaxRange);
+}
+
+void USFW_InteractableSubsystem::ExecuteInteract(APlayerController* PC, AActor* Target)
+{
+	ISFW_InteractableInterface::Execute_Interact(Target, PC);
+}
+
+void USFW_InteractableSubsystem::RequestInteract(APlayerController* PC, AActor* Target, float MaxRange)
+{
+	UWorld* World = GetWorld();
+	if (!World || !PC || !PC->HasAuthority())
+	{
+		return;
+	}
+
+	// Gates the cached-LOS path too, so a fresh cache can't fire on a picked-up target
+	if (!CanInteractNow(PC, Target, MaxRange))
+	{
+		return;
+	}
+
+	const FInteractKey Key(PC, Target);
+	const double Now = World->GetTimeSeconds();
+	const FVector PawnLoc = PC->GetPawn()->GetActorLocation();
+
+	if (const FValidation* Cached = ValidationCache.Find(Key))
+	{
+		if (Now < Cached->ExpireTime
+			&& FVector::DistSquared(Cached->PawnLocation, PawnLoc) <= FMath::Square(ValidationMoveTolerance))
+		{
+			if (Cached->bVisible)
+			{
+				ExecuteInteract(PC, Target);
+			}
+			return;
+		}
+	}
+
+	if (PendingLOS.Contains(Key))
+	{
+		return; // coalesced into the trace already in flight
+	}
+
+	FVector EyesLoc; FRotator EyesRot;
+	PC->GetPlayerViewPoint(EyesLoc, EyesRot);
+
+	float BoundsRadius = 0.f;
+	const FVector TargetPoint = ComputeFocusPoint(Target, BoundsRadius);
+
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(InteractLOS), false, PC->GetPawn());
+
+	const FTraceDelegate Delegate = FTraceDelegate::CreateUObject(this, &USFW_InteractableSubsystem::OnLOSTraceDone, Key);
+
+	FPendingLOS& Pending = PendingLOS.Add(Key);
+	Pending.PC = PC;
+	Pending.Target = Target;
+	Pending.MaxRange = MaxRange;
+	Pending.TargetDist = FVector::Dist(EyesLoc, TargetPoint);
+
+	// Async traces issued this frame run together on the next frame's trace batch
+	Pending.Trace = World->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		EyesLoc,
+		TargetPoint,
+		ECC_Visibility,
+		Params,
+		FCollisionResponseParams::DefaultResponseParam,
+		&Delegate);
+}
+
+void USFW_InteractableSubsystem::OnLOSTraceDone(const FTraceHandle& Handle, FTraceDatum& Data, FInteractKey Key)
+{
+	FPendingLOS Pending;
+	if (!PendingLOS.RemoveAndCopyValue(Key, Pending) || Pending.Trace != Handle)
+	{
+		return;
+	}
+
+	APlayerController* PC = Pending.PC.Get();
+	AActor* Target = Pending.Target.Get();
+	UWorld* World = GetWorld();
+	if (!World || !PC || !Target || !PC->GetPawn())
+	{
+		return;
+	}
+
+	const FHitResult* Hit = Data.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
+	const bool bVisible = !Hit
+		|| Hit->GetActor() == Target
+		|| Hit->Distance >= Pending.TargetDist - LOSTolerance;
+
+	const double Now = World->GetTimeSeconds();
+	PruneValidationCache(Now);
+
+	FValidation& Entry = ValidationCache.FindOrAdd(Key);
+	Entry.ExpireTime = Now + ValidationTTL;
+	Entry.PawnLocation = PC->GetPawn()->GetActorLocation();
+	Entry.bVisible = bVisible;
+
+	if (!bVisible)
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("[Interact] %s -> %s rejected (LOS)"), *PC->GetName(), *Target->GetName());
+		return;
+	}
+
+	// A frame has passed; the target may have been picked up or the player moved off
+	if (CanInteractNow(PC, Target, Pending.MaxRange))
+	{
+		ExecuteInteract(PC, Target);
+	}
+}
+
+void USFW_InteractableSubsystem::PruneValidationCache(double Now)
+{
+	if (ValidationCache.Num() < 32)
+	{
+		return;
+	}
+
+	for (auto It = ValidationCache.CreateIterator(); It; ++It)
+	{
+		if (Now >= It->Value.ExpireTime)
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -4,32 +4,64 @@
 #include "Core/Interact/SFW_InteractionComponent.h"
 
 #include "Core/Actors/Interface/SFW_InteractableInterface.h"
+#include "Core/Interact/SFW_InteractableSubsystem.h"
 
 #include "GameFramework/Actor.h"
 #include "GameFramework/PlayerController.h"
 #include "GameFramework/Pawn.h"
 #include "Engine/World.h"
+#include "TimerManager.h"
 #include "DrawDebugHelpers.h"
 
 USFW_InteractionComponent::USFW_InteractionComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false; // enabled only for the local pawn, see RefreshFocusEnabled
 	SetIsReplicatedByDefault(false); // client-only logic; RPC handles server
 }
 
 void USFW_InteractionComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	ConfirmTraceDelegate.BindUObject(this, &USFW_InteractionComponent::OnConfirmTraceDone);
+
+	// Local control can arrive after BeginPlay (possession / OnRep_Controller)
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.AddDynamic(this, &USFW_InteractionComponent::HandleControllerChanged);
+	}
+
+	RefreshFocusEnabled();
+}
+
+void USFW_InteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (APawn* OwnerPawn = Cast<APawn>(GetOwner()))
+	{
+		OwnerPawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &USFW_InteractionComponent::HandleControllerChanged);
+	}
+
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(WakeTimer);
+	}
+
+	ConfirmTraceDelegate.Unbind();
+	ConfirmTrace = FTraceHandle();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void USFW_InteractionComponent::HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	RefreshFocusEnabled();
 }
 
 void USFW_InteractionComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	// Only the owning client updates focus
-	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
-	if (!OwnerPawn || !OwnerPawn->IsLocallyControlled()) return;
-
 	TraceAccumulator += DeltaTime;
 	const float Interval = (TraceRateHz > 0.f) ? (1.f / TraceRateHz) : 0.1f;
 	if (TraceAccumulator < Interval) return;
@@ -45,7 +77,7 @@ void USFW_InteractionComponent::TryInteract()
 
 void USFW_InteractionComponent::TryUseOrInteract()
 {
-	OnInteractInput();          // later you can branch to a Use path
+	OnInteractInput();          // later you can branch to a "Use" path
 }
 
 APlayerController* USFW_InteractionComponent::GetOwningPC() const
@@ -57,100 +89,231 @@ APlayerController* USFW_InteractionComponent::GetOwningPC() const
 	return nullptr;
 }
 
-void USFW_InteractionComponent::UpdateFocus()
+bool USFW_InteractionComponent::IsLocalPawn() const
+{
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	return OwnerPawn && OwnerPawn->IsLocallyControlled() && GetOwningPC();
+}
+
+// ---------- Sleep / wake ----------
+
+void USFW_InteractionComponent::RefreshFocusEnabled()
 {
-	AActor* NewFocus = nullptr;
-	if (FindBestInteractable(NewFocus))
+	const bool bWant = IsLocalPawn();
+	if (bWant == bFocusEnabled) return;
+	bFocusEnabled = bWant;
+
+	if (bFocusEnabled)
 	{
-		SetFocus(NewFocus);
+		// Start asleep; the first wake check turns the tick on if anything is close
+		Sleep();
+		WakeCheck();
+		return;
 	}
-	else
+
+	if (UWorld* World = GetWorld())
 	{
-		SetFocus(nullptr);
+		World->GetTimerManager().ClearTimer(WakeTimer);
 	}
+	SetComponentTickEnabled(false);
+	ConfirmTrace = FTraceHandle();
+	SetFocus(nullptr);
 }
 
-void USFW_InteractionComponent::SetFocus(AActor* NewFocus)
+void USFW_InteractionComponent::Sleep()
 {
-	if (FocusedActor == NewFocus) return;
-	FocusedActor = NewFocus;
+	SetComponentTickEnabled(false);
+	ConfirmTrace = FTraceHandle();  // drop any in-flight result
+	SetFocus(nullptr);
 
-#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
-	if (bDrawDebug)
+	if (UWorld* World = GetWorld())
 	{
-		if (FocusedActor)
+		if (!World->GetTimerManager().IsTimerActive(WakeTimer))
 		{
-			UE_LOG(LogTemp, Verbose, TEXT("[Interact] Focus -> %s"), *FocusedActor->GetName());
-		}
-		else
-		{
-			UE_LOG(LogTemp, Verbose, TEXT("[Interact] Focus cleared"));
+			World->GetTimerManager().SetTimer(WakeTimer, this, &USFW_InteractionComponent::WakeCheck, WakeCheckInterval, true);
 		}
 	}
-#endif
 }
 
-bool USFW_InteractionComponent::FindBestInteractable(AActor*& OutActor) const
+void USFW_InteractionComponent::WakeCheck()
 {
-	OutActor = nullptr;
+	const APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	const USFW_InteractableSubsystem* Registry = USFW_InteractableSubsystem::Get(this);
+	if (!OwnerPawn || !Registry) return;
+
+	if (Registry->AnyInRange(OwnerPawn->GetPawnViewLocation(), InteractRange))
+	{
+		GetWorld()->GetTimerManager().ClearTimer(WakeTimer);
+		TraceAccumulator = 0.f;
+		SetComponentTickEnabled(true);
+		UpdateFocus();
+	}
+}
 
+// ---------- Focus ----------
+
+void USFW_InteractionComponent::UpdateFocus()
+{
 	APlayerController* PC = GetOwningPC();
-	if (!PC) return false;
+	const USFW_InteractableSubsystem* Registry = USFW_InteractableSubsystem::Get(this);
+	UWorld* World = GetWorld();
+	if (!PC || !Registry || !World) return;
+
+	// Focus target got picked up / hidden since it was confirmed
+	if (AActor* Current = FocusedActor.Get())
+	{
+		if (Current->IsHidden() || Cast<APawn>(Current->GetAttachParentActor()))
+		{
+			SetFocus(nullptr);
+		}
+	}
 
 	FVector EyesLoc; FRotator EyesRot;
 	PC->GetPlayerViewPoint(EyesLoc, EyesRot);
 
-	const FVector Start = EyesLoc;
-	const FVector End = Start + EyesRot.Vector() * InteractRange;
+	TArray<FSFWInteractableCandidate, TInlineAllocator<16>> Candidates;
+	Registry->GatherInRange(EyesLoc, InteractRange, Candidates);
+	if (Candidates.Num() == 0)
+	{
+		Sleep();
+		return;
+	}
+
+	// Previous confirm still in flight; its result lands next frame
+	if (ConfirmTrace.IsValid()) return;
+
+	const FVector ViewDir = EyesRot.Vector();
+	const float TanHalf = FMath::Tan(FMath::DegreesToRadians(FocusConeHalfAngleDeg));
+
+	const FSFWInteractableCandidate* Best = nullptr;
+	float BestScore = -MAX_flt;
+	float BestDist = 0.f;
+
+	for (const FSFWInteractableCandidate& C : Candidates)
+	{
+		if (C.Actor == GetOwner()) continue;
+
+		const FVector ToTarget = C.FocusPoint - EyesLoc;
+		const float Along = FVector::DotProduct(ToTarget, ViewDir);
+		if (Along <= 0.f) continue;
+
+		// Distance off the view ray vs. the cone radius at that depth, widened by the target's size
+		const float Dist = ToTarget.Size();
+		const float Off = FMath::Sqrt(FMath::Max(0.f, FMath::Square(Dist) - FMath::Square(Along)));
+		const float Allowed = Along * TanHalf + C.Radius;
+		if (Off > Allowed) continue;
+
+		float Score = (1.f - Off / FMath::Max(Allowed, KINDA_SMALL_NUMBER)) - DistanceWeight * (Dist / FMath::Max(InteractRange, 1.f));
+		if (C.Actor == FocusedActor.Get())
+		{
+			Score += FocusStickiness;
+		}
+
+		if (Score > BestScore)
+		{
+			BestScore = Score;
+			Best = &C;
+			BestDist = Dist;
+		}
+	}
+
+	if (!Best)
+	{
+		SetFocus(nullptr);
+		return;
+	}
+
+	PendingCandidate = Best->Actor;
+	PendingCandidateDist = BestDist;
 
 	FCollisionQueryParams Params(SCENE_QUERY_STAT(InteractTrace), false, GetOwner());
-	FHitResult Hit;
-	if (!GetWorld()->LineTraceSingleByChannel(Hit, Start, End, ECC_Visibility, Params))
+	ConfirmTrace = World->AsyncLineTraceByChannel(
+		EAsyncTraceType::Single,
+		EyesLoc,
+		Best->FocusPoint,
+		ECC_Visibility,
+		Params,
+		FCollisionResponseParams::DefaultResponseParam,
+		&ConfirmTraceDelegate);
+}
+
+void USFW_InteractionComponent::OnConfirmTraceDone(const FTraceHandle& Handle, FTraceDatum& Data)
+{
+	if (Handle != ConfirmTrace)
 	{
-		if (bDrawDebug) DrawDebugLine(GetWorld(), Start, End, FColor::Red, false, 0.12f, 0, 0.5f);
-		return false;
+		return; // stale (slept / lost control meanwhile)
 	}
+	ConfirmTrace = FTraceHandle();
 
-	AActor* HitActor = Hit.GetActor();
-	if (bDrawDebug) DrawDebugLine(GetWorld(), Start, Hit.ImpactPoint, FColor::Cyan, false, 0.12f, 0, 0.8f);
+	AActor* Candidate = PendingCandidate.Get();
+	PendingCandidate.Reset();
+	if (!Candidate || !IsComponentTickEnabled())
+	{
+		return;
+	}
+
+	const FHitResult* Hit = Data.OutHits.FindByPredicate([](const FHitResult& H) { return H.bBlockingHit; });
 
-	if (!HitActor) return false;
-	if (!HitActor->GetClass()->ImplementsInterface(USFW_InteractableInterface::StaticClass())) return false;
+	// Clear line, the candidate itself, or something right at its focus point (its own shell)
+	const bool bVisible = !Hit
+		|| Hit->GetActor() == Candidate
+		|| Hit->Distance >= PendingCandidateDist - OcclusionTolerance;
 
-	// Range check (safety; the line already clamps range)
-	const float Dist = FVector::Dist(EyesLoc, Hit.ImpactPoint);
-	if (Dist > InteractRange + 2.f) return false;
+	if (bDrawDebug)
+	{
+		const FVector End = Hit ? Hit->ImpactPoint : Data.End;
+		DrawDebugLine(GetWorld(), Data.Start, End, bVisible ? FColor::Cyan : FColor::Red, false, 0.12f, 0, 0.8f);
+	}
 
-	OutActor = HitActor;
-	return true;
+	SetFocus(bVisible ? Candidate : nullptr);
+}
+
+void USFW_InteractionComponent::SetFocus(AActor* NewFocus)
+{
+	if (FocusedActor.Get() == NewFocus) return;
+	FocusedActor = NewFocus;
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+	if (bDrawDebug)
+	{
+		if (NewFocus)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("[Interact] Focus -> %s"), *NewFocus->GetName());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("[Interact] Focus cleared"));
+		}
+	}
+#endif
 }
 
 void USFW_InteractionComponent::OnInteractInput()
 {
 	// Client entry. Use current focus.
-	if (!FocusedActor) return;
+	AActor* Target = FocusedActor.Get();
+	if (!Target) return;
 
 	APawn* OwnerPawn = Cast<APawn>(GetOwner());
 	if (!OwnerPawn) return;
 
-	// Server performs the interaction
+	// Listen-server host takes the same validated path as remote clients
 	if (OwnerPawn->HasAuthority())
 	{
-		if (APlayerController* PC = Cast<APlayerController>(OwnerPawn->GetController()))
-		{
-			if (ValidateServerInteract(FocusedActor, PC))
-			{
-				ISFW_InteractableInterface::Execute_Interact(FocusedActor, PC);
-			}
-		}
+		HandleServerInteract(Target);
 	}
 	else
 	{
-		Server_TryInteract(FocusedActor);
+		Server_TryInteract(Target);
 	}
 }
 
 void USFW_InteractionComponent::Server_TryInteract_Implementation(AActor* Target)
+{
+	HandleServerInteract(Target);
+}
+
+void USFW_InteractionComponent::HandleServerInteract(AActor* Target)
 {
 	if (!Target) return;
 
@@ -167,27 +330,9 @@ void USFW_InteractionComponent::Server_TryInteract_Implementation(AActor* Target
 	APlayerController* PC = GetOwningPC();
 	if (!PC) return;
 
-	if (!ValidateServerInteract(Target, PC)) return;
-
-	ISFW_InteractableInterface::Execute_Interact(Target, PC);
+	// Range / interface / cached-or-async LOS, then Interact
+	if (USFW_InteractableSubsystem* Registry = USFW_InteractableSubsystem::Get(this))
+	{
+		Registry->RequestInteract(PC, Target, InteractRange);
+	}
 }
-
-bool USFW_InteractionComponent::ValidateServerInteract(AActor* Target, APlayerController* PC) const
-{
-	if (!Target || !PC) return false;
-
-	APawn* Pawn = PC->GetPawn();
-	if (!Pawn) return false;
-
-	// 1) Distance gate (use pawn location to target location)
-	const float Dist = FVector::Dist(Pawn->GetActorLocation(), Target->GetActorLocation());
-	if (Dist > (InteractRange + 30.f)) return false;
-
-	// 2) Line-of-sight gate
-	if (!PC->LineOfSightTo(Target)) return false;
-
-	// 3) Interface check
-	if (!Target->GetClass()->ImplementsInterface(USFW_InteractableInterface::StaticClass())) return false;
-
-	return true;
-}
\ No newline at end of file
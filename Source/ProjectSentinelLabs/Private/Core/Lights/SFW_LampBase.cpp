@@ -32,6 +32,7 @@ namespace
 ASFW_LampBase::ASFW_LampBase()
 {
 	bReplicates = true;
+	NetDormancy = DORM_Initial; // lamp state changes flush via USFW_LampControllerComponent
 
 	Mesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("Mesh"));
 	SetRootComponent(Mesh);
@@ -0,0 +1,51 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Net/SFW_CosmeticEvent.h"
+
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+
+float FSFWCosmeticEvent::GetServerTime(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	if (!World)
+	{
+		return 0.f;
+	}
+
+	const AGameStateBase* GS = World->GetGameState();
+	return GS ? static_cast<float>(GS->GetServerWorldTimeSeconds()) : World->GetTimeSeconds();
+}
+
+void FSFWCosmeticEvent::Fire(const UObject* WorldContextObject, uint8 InType, const FVector& InLocation, const FVector& InPayload)
+{
+	// Skip 0 on wrap so a fired event never looks like "never fired"
+	Counter = (Counter == MAX_uint8) ? 1 : Counter + 1;
+	Type = InType;
+	ServerTime = GetServerTime(WorldContextObject);
+	Location = InLocation;
+	Payload = InPayload;
+}
+
+float FSFWCosmeticEventReceiver::GetAge(const UObject* WorldContextObject, const FSFWCosmeticEvent& Event)
+{
+	return FMath::Max(0.f, FSFWCosmeticEvent::GetServerTime(WorldContextObject) - Event.ServerTime);
+}
+
+ESFWCosmeticEventReceipt FSFWCosmeticEventReceiver::Receive(const UObject* WorldContextObject, const FSFWCosmeticEvent& Event, float MaxAge)
+{
+	if (bInitialized && Event.Counter == LastCounter)
+	{
+		return ESFWCosmeticEventReceipt::None;
+	}
+
+	bInitialized = true;
+	LastCounter = Event.Counter;
+
+	if (Event.Counter == 0)
+	{
+		return ESFWCosmeticEventReceipt::None;
+	}
+
+	return (GetAge(WorldContextObject, Event) > MaxAge) ? ESFWCosmeticEventReceipt::Stale : ESFWCosmeticEventReceipt::Play;
+}
@@ -0,0 +1,523 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Net/SFW_ReplicationGraph.h"
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/AnomalySystems/SFW_AnomalyDecisionSystem.h"
+#include "Core/AnomalySystems/SFW_AnomalyController.h"
+
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerState.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY(LogSFWRepGraph);
+
+// ---------- Graph ----------
+
+USFW_ReplicationGraph::USFW_ReplicationGraph()
+{
+}
+
+void USFW_ReplicationGraph::InitGlobalActorClassSettings()
+{
+	Super::InitGlobalActorClassSettings();
+
+	// Carry each class's own NetUpdateFrequency / NetCullDistance over into the graph.
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!Class->IsChildOf(AActor::StaticClass())
+			|| Class->HasAnyClassFlags(CLASS_Abstract | CLASS_Deprecated | CLASS_NewerVersionExists)
+			|| Class->GetName().StartsWith(TEXT("SKEL_"))
+			|| Class->GetName().StartsWith(TEXT("REINST_")))
+		{
+			continue;
+		}
+
+		const AActor* CDO = Class->GetDefaultObject<AActor>();
+		if (!CDO || !CDO->GetIsReplicated())
+		{
+			continue;
+		}
+
+		FClassReplicationInfo Info;
+		Info.ReplicationPeriodFrame = GetReplicationPeriodFrameForFrequency(CDO->GetNetUpdateFrequency());
+		Info.SetCullDistanceSquared(CDO->GetNetCullDistanceSquared());
+		GlobalActorReplicationInfoMap.SetClassInfo(Class, Info);
+	}
+}
+
+void USFW_ReplicationGraph::InitGlobalGraphNodes()
+{
+	AlwaysRelevantNode = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddGlobalGraphNode(AlwaysRelevantNode);
+
+	RoomNode = CreateNewNode<USFW_ReplicationGraphNode_Rooms>();
+	AddGlobalGraphNode(RoomNode);
+
+	// Spreads PlayerStates over frames; routes itself from the GameState's PlayerArray.
+	PlayerStateNode = CreateNewNode<UReplicationGraphNode_PlayerStateFrequencyLimiter>();
+	AddGlobalGraphNode(PlayerStateNode);
+}
+
+void USFW_ReplicationGraph::InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager)
+{
+	Super::InitConnectionGraphNodes(ConnectionManager);
+
+	// PlayerController, its pawn and view target.
+	UReplicationGraphNode_AlwaysRelevant_ForConnection* ForConnection = CreateNewNode<UReplicationGraphNode_AlwaysRelevant_ForConnection>();
+	AddConnectionGraphNode(ForConnection, ConnectionManager);
+
+	// Owner-only actors and inventory equippables; kept current by UpdateOwnerRouting.
+	UReplicationGraphNode_ActorList* OwnerOnly = CreateNewNode<UReplicationGraphNode_ActorList>();
+	AddConnectionGraphNode(OwnerOnly, ConnectionManager);
+	OwnerOnlyNodes.Add(ConnectionManager->NetConnection, OwnerOnly);
+}
+
+void USFW_ReplicationGraph::RemoveClientConnection(UNetConnection* NetConnection)
+{
+	OwnerOnlyNodes.Remove(NetConnection);
+
+	// Anything it owned waits for a new owner connection
+	for (TPair<FActorRepListType, TWeakObjectPtr<UNetConnection>>& Pair : OwnerRouting)
+	{
+		if (Pair.Value.Get() == NetConnection)
+		{
+			Pair.Value.Reset();
+			PendingOwnerRouting.AddUnique(Pair.Key);
+		}
+	}
+
+	Super::RemoveClientConnection(NetConnection);
+}
+
+int32 USFW_ReplicationGraph::ServerReplicateActors(float DeltaSeconds)
+{
+	// Usually empty: actors whose owner had no connection yet (eg, gear of a pawn not possessed yet).
+	for (int32 i = PendingOwnerRouting.Num() - 1; i >= 0; --i)
+	{
+		UpdateOwnerRouting(PendingOwnerRouting[i]);
+	}
+
+	return Super::ServerReplicateActors(DeltaSeconds);
+}
+
+void USFW_ReplicationGraph::NotifyOwnerRoutingChanged(AActor* Actor)
+{
+	const UNetDriver* Driver = Actor ? Actor->GetNetDriver() : nullptr;
+	if (USFW_ReplicationGraph* Graph = Driver ? Cast<USFW_ReplicationGraph>(Driver->GetReplicationDriver()) : nullptr)
+	{
+		Graph->UpdateOwnerRouting(Actor);
+	}
+}
+
+void USFW_ReplicationGraph::UpdateOwnerRouting(AActor* Actor)
+{
+	TWeakObjectPtr<UNetConnection>* Routed = OwnerRouting.Find(Actor);
+	if (!Routed)
+	{
+		return; // not owner-routed, or not added to the graph yet
+	}
+
+	UNetConnection* Conn = Actor->GetNetConnection();
+	UReplicationGraphNode_ActorList* NewList = GetOwnerOnlyNode(Conn);
+	if (!NewList)
+	{
+		Conn = nullptr;
+	}
+
+	UNetConnection* OldConn = Routed->Get();
+	if (OldConn != Conn)
+	{
+		if (UReplicationGraphNode_ActorList* OldList = GetOwnerOnlyNode(OldConn))
+		{
+			OldList->NotifyRemoveNetworkActor(FNewReplicatedActorInfo(Actor));
+		}
+		if (NewList)
+		{
+			NewList->NotifyAddNetworkActor(FNewReplicatedActorInfo(Actor));
+		}
+		*Routed = Conn;
+	}
+
+	if (Conn)
+	{
+		PendingOwnerRouting.RemoveSwap(Actor);
+	}
+	else
+	{
+		PendingOwnerRouting.AddUnique(Actor);
+	}
+
+	// The owner always gets its own items, wherever they are; others only once it is out of the inventory.
+	if (GetMappingPolicy(Actor->GetClass()) == ESFWRepNodeMapping::Equippable)
+	{
+		RoomNode->SetEquippableInWorld(Actor, !(Conn && Actor->IsHidden()));
+	}
+}
+
+UReplicationGraphNode_ActorList* USFW_ReplicationGraph::GetOwnerOnlyNode(UNetConnection* Connection) const
+{
+	const TObjectPtr<UReplicationGraphNode_ActorList>* Found = OwnerOnlyNodes.Find(Connection);
+	return Found ? Found->Get() : nullptr;
+}
+
+ESFWRepNodeMapping USFW_ReplicationGraph::GetMappingPolicy(const UClass* Class) const
+{
+	if (const ESFWRepNodeMapping* Cached = ClassMapping.Find(Class))
+	{
+		return *Cached;
+	}
+
+	const AActor* CDO = Class->GetDefaultObject<AActor>();
+
+	ESFWRepNodeMapping Mapping = ESFWRepNodeMapping::RoomStatic;
+	if (CDO->bAlwaysRelevant
+		|| Class->IsChildOf(AGameStateBase::StaticClass())
+		|| Class->IsChildOf(ASFW_AnomalyDecisionSystem::StaticClass())
+		|| Class->IsChildOf(ASFW_AnomalyController::StaticClass()))
+	{
+		Mapping = ESFWRepNodeMapping::AlwaysRelevant;
+	}
+	else if (Class->IsChildOf(APlayerController::StaticClass()) || Class->IsChildOf(APlayerState::StaticClass()))
+	{
+		Mapping = ESFWRepNodeMapping::NotRouted;
+	}
+	else if (CDO->bOnlyRelevantToOwner)
+	{
+		Mapping = ESFWRepNodeMapping::OwnerOnly;
+	}
+	else if (Class->IsChildOf(ASFW_EquippableBase::StaticClass()))
+	{
+		Mapping = ESFWRepNodeMapping::Equippable;
+	}
+	else if (Class->IsChildOf(APawn::StaticClass()) || CDO->IsReplicatingMovement())
+	{
+		Mapping = ESFWRepNodeMapping::RoomDynamic;
+	}
+
+	ClassMapping.Add(Class, Mapping);
+	return Mapping;
+}
+
+void USFW_ReplicationGraph::RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ESFWRepNodeMapping::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyAddNetworkActor(ActorInfo);
+		break;
+	case ESFWRepNodeMapping::RoomStatic:
+		RoomNode->AddStaticActor(ActorInfo, GlobalInfo);
+		break;
+	case ESFWRepNodeMapping::RoomDynamic:
+		RoomNode->AddDynamicActor(ActorInfo);
+		break;
+	case ESFWRepNodeMapping::OwnerOnly:
+	case ESFWRepNodeMapping::Equippable:
+		OwnerRouting.Add(ActorInfo.Actor);
+		UpdateOwnerRouting(ActorInfo.Actor);
+		break;
+	default:
+		break;
+	}
+}
+
+void USFW_ReplicationGraph::RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo)
+{
+	switch (GetMappingPolicy(ActorInfo.Class))
+	{
+	case ESFWRepNodeMapping::AlwaysRelevant:
+		AlwaysRelevantNode->NotifyRemoveNetworkActor(ActorInfo);
+		break;
+	case ESFWRepNodeMapping::RoomStatic:
+		RoomNode->RemoveStaticActor(ActorInfo);
+		break;
+	case ESFWRepNodeMapping::RoomDynamic:
+		RoomNode->RemoveDynamicActor(ActorInfo);
+		break;
+	case ESFWRepNodeMapping::OwnerOnly:
+	case ESFWRepNodeMapping::Equippable:
+	{
+		TWeakObjectPtr<UNetConnection> Conn;
+		if (OwnerRouting.RemoveAndCopyValue(ActorInfo.Actor, Conn))
+		{
+			if (UReplicationGraphNode_ActorList* OwnerOnly = GetOwnerOnlyNode(Conn.Get()))
+			{
+				OwnerOnly->NotifyRemoveNetworkActor(ActorInfo);
+			}
+		}
+		PendingOwnerRouting.RemoveSwap(ActorInfo.Actor);
+		RoomNode->SetEquippableInWorld(ActorInfo.Actor, false);
+		break;
+	}
+	default:
+		break;
+	}
+}
+
+// ---------- Room node ----------
+
+USFW_ReplicationGraphNode_Rooms::USFW_ReplicationGraphNode_Rooms()
+{
+	bRequiresPrepareForReplicationCall = true;
+}
+
+void USFW_ReplicationGraphNode_Rooms::NotifyResetAllNetworkActors()
+{
+	for (FRoomCell& Cell : Cells)
+	{
+		Cell.StaticAwake.Reset();
+		Cell.Dynamic.Reset();
+	}
+	StaticCell.Reset();
+	DynamicActors.Reset();
+	Equippables.Reset();
+
+	Super::NotifyResetAllNetworkActors();
+}
+
+int32 USFW_ReplicationGraphNode_Rooms::CellFor(const AActor* Actor) const
+{
+	const USFW_RoomSubsystem* RoomSys = GraphGlobals.IsValid() ? USFW_RoomSubsystem::Get(GraphGlobals->World) : nullptr;
+	const int32 Room = RoomSys ? RoomSys->FindRoomIndexAt(Actor->GetActorLocation()) : INDEX_NONE;
+	return Cells.IsValidIndex(Room) && Room != OutsideCell() ? Room : OutsideCell();
+}
+
+void USFW_ReplicationGraphNode_Rooms::RebuildCells()
+{
+	const USFW_RoomSubsystem* RoomSys = GraphGlobals.IsValid() ? USFW_RoomSubsystem::Get(GraphGlobals->World) : nullptr;
+	const uint32 Serial = RoomSys ? RoomSys->GetBuildSerial() : 0;
+	if (Cells.Num() > 0 && Serial == CellsSerial)
+	{
+		return;
+	}
+
+	FGlobalActorReplicationInfoMap& InfoMap = *GraphGlobals->GlobalActorReplicationInfoMap;
+
+	// Pull every static actor out of its old cell before the layout changes.
+	TArray<FActorRepListType> Statics;
+	StaticCell.GenerateKeyArray(Statics);
+	for (const TPair<FActorRepListType, int32>& Pair : StaticCell)
+	{
+		EvictStatic(Pair.Key, InfoMap.Get(Pair.Key), Pair.Value);
+	}
+	StaticCell.Reset();
+
+	const int32 NumCells = (RoomSys ? RoomSys->GetRooms().Num() : 0) + 1;
+
+	for (int32 i = NumCells; i < Cells.Num(); ++i)
+	{
+		RemoveChildNode(Cells[i].Dormant);
+	}
+	const int32 OldNum = Cells.Num();
+	Cells.SetNum(NumCells);
+	for (int32 i = OldNum; i < NumCells; ++i)
+	{
+		Cells[i].Dormant = CreateChildNode<UReplicationGraphNode_DormancyNode>();
+	}
+	CellsSerial = Serial;
+
+	for (FActorRepListType Actor : Statics)
+	{
+		const int32 Cell = CellFor(Actor);
+		InsertStatic(Actor, InfoMap.Get(Actor), Cell);
+		StaticCell.Add(Actor, Cell);
+	}
+
+	UE_LOG(LogSFWRepGraph, Log, TEXT("[RepGraph] Laid out %d room cells, %d static actors"), NumCells - 1, Statics.Num());
+}
+
+void USFW_ReplicationGraphNode_Rooms::InsertStatic(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, int32 Cell)
+{
+	if (GlobalInfo.bWantsToBeDormant)
+	{
+		Cells[Cell].Dormant->AddDormantActor(FNewReplicatedActorInfo(Actor), GlobalInfo);
+	}
+	else
+	{
+		Cells[Cell].StaticAwake.Add(Actor);
+	}
+}
+
+void USFW_ReplicationGraphNode_Rooms::EvictStatic(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, int32 Cell)
+{
+	if (!Cells.IsValidIndex(Cell))
+	{
+		return;
+	}
+
+	if (GlobalInfo.bWantsToBeDormant)
+	{
+		Cells[Cell].Dormant->RemoveDormantActor(FNewReplicatedActorInfo(Actor), GlobalInfo);
+	}
+	else
+	{
+		Cells[Cell].StaticAwake.RemoveFast(Actor);
+	}
+}
+
+void USFW_ReplicationGraphNode_Rooms::AddStaticActor(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo)
+{
+	RebuildCells();
+
+	const int32 Cell = CellFor(ActorInfo.Actor);
+	InsertStatic(ActorInfo.Actor, GlobalInfo, Cell);
+	StaticCell.Add(ActorInfo.Actor, Cell);
+
+	GlobalInfo.Events.DormancyChange.AddUObject(this, &USFW_ReplicationGraphNode_Rooms::OnStaticDormancyChange);
+}
+
+void USFW_ReplicationGraphNode_Rooms::RemoveStaticActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	int32 Cell = INDEX_NONE;
+	if (!StaticCell.RemoveAndCopyValue(ActorInfo.Actor, Cell))
+	{
+		return;
+	}
+
+	FGlobalActorReplicationInfo& GlobalInfo = GraphGlobals->GlobalActorReplicationInfoMap->Get(ActorInfo.Actor);
+	EvictStatic(ActorInfo.Actor, GlobalInfo, Cell);
+	GlobalInfo.Events.DormancyChange.RemoveAll(this);
+}
+
+void USFW_ReplicationGraphNode_Rooms::OnStaticDormancyChange(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, ENetDormancy NewValue, ENetDormancy OldValue)
+{
+	const int32* CellPtr = StaticCell.Find(Actor);
+	if (!CellPtr || !Cells.IsValidIndex(*CellPtr))
+	{
+		return;
+	}
+
+	const bool bWasDormant = OldValue > DORM_Awake;
+	const bool bIsDormant = NewValue > DORM_Awake;
+	if (bWasDormant == bIsDormant)
+	{
+		return;
+	}
+
+	FRoomCell& Cell = Cells[*CellPtr];
+	if (bIsDormant)
+	{
+		Cell.StaticAwake.RemoveFast(Actor);
+		Cell.Dormant->AddDormantActor(FNewReplicatedActorInfo(Actor), GlobalInfo);
+	}
+	else
+	{
+		Cell.Dormant->RemoveDormantActor(FNewReplicatedActorInfo(Actor), GlobalInfo);
+		Cell.StaticAwake.Add(Actor);
+	}
+}
+
+void USFW_ReplicationGraphNode_Rooms::PrepareForReplication()
+{
+	RebuildCells();
+
+	for (FRoomCell& Cell : Cells)
+	{
+		Cell.Dynamic.Reset();
+	}
+
+	// ---------- Dynamic actors: re-bucket by current location ----------
+	for (FActorRepListType Actor : DynamicActors)
+	{
+		Cells[CellFor(Actor)].Dynamic.Add(Actor);
+	}
+
+	// ---------- Equippables in the world (owner lists are kept by the graph) ----------
+	for (FActorRepListType Actor : Equippables)
+	{
+		Cells[CellFor(Actor)].Dynamic.Add(Actor);
+	}
+}
+
+void USFW_ReplicationGraphNode_Rooms::SetEquippableInWorld(FActorRepListType Actor, bool bInWorld)
+{
+	const bool bListed = Equippables.Contains(Actor);
+	if (bInWorld && !bListed)
+	{
+		Equippables.Add(Actor);
+	}
+	else if (!bInWorld && bListed)
+	{
+		Equippables.RemoveFast(Actor);
+	}
+}
+
+void USFW_ReplicationGraphNode_Rooms::GatherCell(int32 Cell, const FConnectionGatherActorListParameters& Params)
+{
+	FRoomCell& C = Cells[Cell];
+	if (C.StaticAwake.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(C.StaticAwake);
+	}
+	if (C.Dynamic.Num() > 0)
+	{
+		Params.OutGatheredReplicationLists.AddReplicationActorList(C.Dynamic);
+	}
+	C.Dormant->GatherActorListsForConnection(Params);
+}
+
+void USFW_ReplicationGraphNode_Rooms::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	if (Cells.Num() == 0)
+	{
+		return;
+	}
+
+	const USFW_RoomSubsystem* RoomSys = USFW_RoomSubsystem::Get(GraphGlobals->World);
+
+	TArray<int32, TInlineAllocator<16>> Visible;
+	Visible.Add(OutsideCell());
+
+	bool bViewerOutside = (RoomSys == nullptr);
+	TArray<int32> Neighbors;
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		const int32 Room = RoomSys ? RoomSys->FindRoomIndexAt(Viewer.ViewLocation) : INDEX_NONE;
+		if (!Cells.IsValidIndex(Room) || Room == OutsideCell())
+		{
+			bViewerOutside = true;
+			break;
+		}
+
+		// Every volume of the viewer's room (rooms may span several volumes sharing a RoomId).
+		for (const int32 Same : RoomSys->GetRoomsSharingId(Room))
+		{
+			if (Cells.IsValidIndex(Same))
+			{
+				Visible.AddUnique(Same);
+			}
+		}
+
+		// Structural neighbours, regardless of door state: a door opening must not pop its room in late.
+		RoomSys->GetNeighborRooms(Room, /*bOpenOnly*/ false, Neighbors);
+		for (const int32 N : Neighbors)
+		{
+			if (Cells.IsValidIndex(N))
+			{
+				Visible.AddUnique(N);
+			}
+		}
+	}
+
+	if (bViewerOutside)
+	{
+		// Outside every room (yard, spawn): fall back to plain cull distance over everything.
+		for (int32 i = 0; i < Cells.Num(); ++i)
+		{
+			GatherCell(i, Params);
+		}
+		return;
+	}
+
+	for (const int32 Cell : Visible)
+	{
+		GatherCell(Cell, Params);
+	}
+}
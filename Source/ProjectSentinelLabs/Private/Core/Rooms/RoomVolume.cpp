@@ -41,6 +41,13 @@ void ARoomVolume::BeginPlay()
     // Warn if someone configured a hallway as Base/Rift in GameState.
     if (ASFW_GameState* GS = GetSFWGameState())
     {
+        if (HasAuthority())
+        {
+            RoomIndex = GS->RegisterRoom(RoomId, bIsSafeRoom && RoomType != ERoomType::Hallway);
+            GS->OnOccupancySlotReleased.AddUObject(this, &ARoomVolume::HandleOccupancySlotReleased);
+            GS->OnOccupantPossessed.AddUObject(this, &ARoomVolume::HandleOccupantPossessed);
+        }
+
         if (RoomType == ERoomType::Hallway)
         {
             if (GS->BaseRoom == this)
@@ -58,11 +65,34 @@ void ARoomVolume::BeginPlay()
     OnActorEndOverlap.AddDynamic(this, &ARoomVolume::HandleEndOverlap);
 }
 
+void ARoomVolume::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    if (ASFW_GameState* GS = GetSFWGameState())
+    {
+        GS->OnOccupancySlotReleased.RemoveAll(this);
+        GS->OnOccupantPossessed.RemoveAll(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 ASFW_GameState* ARoomVolume::GetSFWGameState() const
 {
     return GetWorld() ? GetWorld()->GetGameState<ASFW_GameState>() : nullptr;
 }
 
+int32 ARoomVolume::GetRoomIndex() const
+{
+    if (RoomIndex == INDEX_NONE)
+    {
+        if (const ASFW_GameState* GS = GetSFWGameState())
+        {
+            RoomIndex = GS->FindRoomIndex(RoomId);
+        }
+    }
+    return RoomIndex;
+}
+
 bool ARoomVolume::IsPlayerPawn(AActor* Actor) const
 {
     const APawn* Pawn = Cast<APawn>(Actor);
@@ -138,67 +168,89 @@ void ARoomVolume::NotifyPresenceChanged(APlayerState* PS, bool bEnter) const
     }
 }
 
-void ARoomVolume::UpdateSafeFlag(APawn* Pawn, int32 Delta)
+void ARoomVolume::UpdateOccupancy(APawn* Pawn, bool bEnter)
 {
-    if (!Pawn) return;
+    ASFW_GameState* GS = GetSFWGameState();
+    if (!Pawn || !GS || GetRoomIndex() == INDEX_NONE) return;
 
-    ASFW_PlayerState* PS = Pawn->GetPlayerState<ASFW_PlayerState>();
-    if (!PS) return;
+    if (bEnter)
+    {
+        if (OccupantSlots.Contains(Pawn)) return;
 
-    int32& Count = SafeOverlapCount.FindOrAdd(PS);
-    Count = FMath::Max(0, Count + Delta);
+        const ASFW_PlayerState* PS = Pawn->GetPlayerState<ASFW_PlayerState>();
+        if (!PS || PS->OccupancySlot == INDEX_NONE)
+        {
+            // Spawn overlaps arrive before possession; flagged from HandleOccupantPossessed.
+            if (!Pawn->GetController())
+            {
+                PendingOccupants.Add(Pawn);
+            }
+            return;
+        }
 
-    if (PS->HasAuthority())
+        PendingOccupants.Remove(Pawn);
+        OccupantSlots.Add(Pawn, PS->OccupancySlot);
+        GS->AddRoomOccupant(RoomIndex, PS->OccupancySlot);
+    }
+    else
     {
-        PS->SetInSafeRoom(Count > 0);
+        PendingOccupants.Remove(Pawn);
+
+        // Use the slot recorded on enter; the pawn may already be unpossessed.
+        int32 Slot = INDEX_NONE;
+        if (OccupantSlots.RemoveAndCopyValue(Pawn, Slot))
+        {
+            GS->RemoveRoomOccupant(RoomIndex, Slot);
+        }
     }
 }
 
-void ARoomVolume::UpdateRiftFlag(APawn* Pawn, bool bEnter)
+void ARoomVolume::HandleOccupancySlotReleased(int32 Slot)
 {
-    if (!Pawn) return;
-
-    ASFW_GameState* GS = GetSFWGameState();
-    if (!GS) return;
-
-    // Only the server should mark flags on PlayerState
-    ASFW_PlayerState* PS = Pawn->GetPlayerState<ASFW_PlayerState>();
-    if (!PS || !PS->HasAuthority()) return;
-
-    const bool bThisIsRift = (GS->RiftRoom == this);
-
-    if (!bThisIsRift)
+    // GameState already cleared the bit and ref counts; just drop our records
+    for (auto It = OccupantSlots.CreateIterator(); It; ++It)
     {
-        // Only changes when this volume IS the active RiftRoom
-        return;
+        if (It.Value() == Slot)
+        {
+            It.RemoveCurrent();
+        }
     }
+}
 
-    PS->SetInRiftRoom(bEnter);
+void ARoomVolume::HandleOccupantPossessed(APawn* Pawn)
+{
+    if (Pawn && PendingOccupants.Contains(Pawn))
+    {
+        UpdateOccupancy(Pawn, /*bEnter*/ true);
+    }
 }
 
 void ARoomVolume::HandleBeginOverlap(AActor* OverlappedActor, AActor* OtherActor)
 {
-    if (!HasAuthority() || !OtherActor || !ShouldProcess(OtherActor))
+    if (!HasAuthority() || !OtherActor)
+    {
+        return;
+    }
+
+    // Occupancy bypasses the debounce so enter/exit always pair up.
+    // Any pawn counts: one spawned inside is not player-controlled until possessed.
+    if (APawn* Pawn = Cast<APawn>(OtherActor))
+    {
+        UpdateOccupancy(Pawn, /*bEnter*/ true);
+    }
+
+    if (!ShouldProcess(OtherActor))
     {
         return;
     }
 
-    // 1) Player handling (unchanged)
+    // 1) Player handling; safe / rift state follows from the occupancy table
     if (IsPlayerPawn(OtherActor))
     {
-        APawn* Pawn = Cast<APawn>(OtherActor);
-        APlayerState* GenericPS = GetPlayerStateFromActor(OtherActor);
-        if (GenericPS)
+        if (APlayerState* GenericPS = GetPlayerStateFromActor(OtherActor))
         {
             NotifyPresenceChanged(GenericPS, /*bEnter*/ true);
         }
-
-        if (bIsSafeRoom && RoomType != ERoomType::Hallway)
-        {
-            UpdateSafeFlag(Pawn, +1);
-        }
-
-        UpdateRiftFlag(Pawn, /*bEnter*/ true);
     }
 
     // 2) Prop handling
@@ -216,27 +268,28 @@ void ARoomVolume::HandleBeginOverlap(AActor* OverlappedActor, AActor* OtherActor
 
 void ARoomVolume::HandleEndOverlap(AActor* OverlappedActor, AActor* OtherActor)
 {
-    if (!HasAuthority() || !OtherActor || !ShouldProcess(OtherActor))
+    if (!HasAuthority() || !OtherActor)
     {
         return;
     }
 
-    // 1) Player handling (unchanged)
+    if (APawn* Pawn = Cast<APawn>(OtherActor))
+    {
+        UpdateOccupancy(Pawn, /*bEnter*/ false);
+    }
+
+    if (!ShouldProcess(OtherActor))
+    {
+        return;
+    }
+
+    // 1) Player handling; safe / rift state follows from the occupancy table
     if (IsPlayerPawn(OtherActor))
     {
-        APawn* Pawn = Cast<APawn>(OtherActor);
-        APlayerState* GenericPS = GetPlayerStateFromActor(OtherActor);
-        if (GenericPS)
+        if (APlayerState* GenericPS = GetPlayerStateFromActor(OtherActor))
         {
             NotifyPresenceChanged(GenericPS, /*bEnter*/ false);
         }
-
-        if (bIsSafeRoom && RoomType != ERoomType::Hallway)
-        {
-            UpdateSafeFlag(Pawn, -1);
-        }
-
-        UpdateRiftFlag(Pawn, /*bEnter*/ false);
     }
 
     // 2) Prop handling
@@ -0,0 +1,555 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "Core/Rooms/SFW_RoomSubsystem.h"
+#include "Core/Rooms/RoomVolume.h"
+#include "Core/Actors/SFW_DoorBase.h"
+
+#include "Algo/Sort.h"
+#include "Components/BoxComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "Misc/ScopeExit.h"
+
+DEFINE_LOG_CATEGORY(LogSFWRooms);
+
+USFW_RoomSubsystem* USFW_RoomSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<USFW_RoomSubsystem>() : nullptr;
+}
+
+bool USFW_RoomSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USFW_RoomSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+	Rebuild();
+}
+
+void USFW_RoomSubsystem::Deinitialize()
+{
+	Rooms.Reset();
+	Boxes.Reset();
+	CellStart.Reset();
+	CellRooms.Reset();
+	EdgeStart.Reset();
+	EdgeTo.Reset();
+	EdgeDoor.Reset();
+	EdgeOpen.Reset();
+	RoomGroup.Reset();
+	GroupStart.Reset();
+	GroupRooms.Reset();
+	HopDistance.Reset();
+	Doors.Reset();
+	DoorToIndex.Reset();
+	DoorEdges.Reset();
+	Super::Deinitialize();
+}
+
+void USFW_RoomSubsystem::Rebuild()
+{
+	++BuildSerial;
+	ON_SCOPE_EXIT { OnRebuilt.Broadcast(); };
+
+	Rooms.Reset();
+	Boxes.Reset();
+	CellStart.Reset();
+	CellRooms.Reset();
+	GridBounds = FBox(ForceInit);
+	GridDims = FIntVector::ZeroValue;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	// Graph is rebuilt below once the grid exists; clear it now in case there are no rooms.
+	BuildGraph();
+
+	// ---------- Gather boxes ----------
+	TArray<FBox> RoomAABBs;
+	for (TActorIterator<ARoomVolume> It(World); It; ++It)
+	{
+		ARoomVolume* Vol = *It;
+		const UBoxComponent* Box = Vol ? Cast<UBoxComponent>(Vol->GetCollisionComponent()) : nullptr;
+		if (!Box) continue;
+
+		const FTransform& T = Box->GetComponentTransform();
+
+		FRoomBox& RB = Boxes.AddDefaulted_GetRef();
+		RB.Center = Box->GetComponentLocation();
+		RB.AxisX = T.GetUnitAxis(EAxis::X);
+		RB.AxisY = T.GetUnitAxis(EAxis::Y);
+		RB.AxisZ = T.GetUnitAxis(EAxis::Z);
+		RB.Extent = Box->GetScaledBoxExtent();
+
+		Rooms.Add(Vol);
+		RoomAABBs.Add(Box->Bounds.GetBox());
+		GridBounds += RoomAABBs.Last();
+	}
+
+	if (Rooms.Num() == 0)
+	{
+		UE_LOG(LogSFWRooms, Log, TEXT("[RoomSubsystem] No room volumes in %s"), *World->GetName());
+		return;
+	}
+
+	// ---------- Grid dimensions ----------
+	const FVector Size = GridBounds.GetSize();
+	GridCellSize = FMath::Max(CellSize, 1.f);
+	auto DimsFor = [&Size](float Cell)
+		{
+			return FIntVector(
+				FMath::Max(1, FMath::CeilToInt(Size.X / Cell)),
+				FMath::Max(1, FMath::CeilToInt(Size.Y / Cell)),
+				FMath::Max(1, FMath::CeilToInt(Size.Z / Cell)));
+		};
+
+	GridDims = DimsFor(GridCellSize);
+	while ((int64)GridDims.X * GridDims.Y * GridDims.Z > MaxCells)
+	{
+		GridCellSize *= 2.f;
+		GridDims = DimsFor(GridCellSize);
+	}
+
+	const int32 NumCells = GridDims.X * GridDims.Y * GridDims.Z;
+
+	auto CellRange = [this](const FBox& B, FIntVector& Min, FIntVector& Max)
+		{
+			const FVector Lo = (B.Min - GridBounds.Min) / GridCellSize;
+			const FVector Hi = (B.Max - GridBounds.Min) / GridCellSize;
+			Min = FIntVector(
+				FMath::Clamp(FMath::FloorToInt(Lo.X), 0, GridDims.X - 1),
+				FMath::Clamp(FMath::FloorToInt(Lo.Y), 0, GridDims.Y - 1),
+				FMath::Clamp(FMath::FloorToInt(Lo.Z), 0, GridDims.Z - 1));
+			Max = FIntVector(
+				FMath::Clamp(FMath::FloorToInt(Hi.X), 0, GridDims.X - 1),
+				FMath::Clamp(FMath::FloorToInt(Hi.Y), 0, GridDims.Y - 1),
+				FMath::Clamp(FMath::FloorToInt(Hi.Z), 0, GridDims.Z - 1));
+		};
+
+	// ---------- Two-pass CSR fill ----------
+	TArray<int32> Counts;
+	Counts.SetNumZeroed(NumCells + 1);
+
+	for (int32 R = 0; R < Rooms.Num(); ++R)
+	{
+		FIntVector Min, Max;
+		CellRange(RoomAABBs[R], Min, Max);
+		for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+			for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+				for (int32 X = Min.X; X <= Max.X; ++X)
+				{
+					++Counts[X + GridDims.X * (Y + GridDims.Y * Z)];
+				}
+	}
+
+	CellStart.SetNumUninitialized(NumCells + 1);
+	int32 Running = 0;
+	for (int32 C = 0; C < NumCells; ++C)
+	{
+		CellStart[C] = Running;
+		Running += Counts[C];
+		Counts[C] = CellStart[C]; // reuse as write cursor
+	}
+	CellStart[NumCells] = Running;
+	CellRooms.SetNumUninitialized(Running);
+
+	for (int32 R = 0; R < Rooms.Num(); ++R)
+	{
+		FIntVector Min, Max;
+		CellRange(RoomAABBs[R], Min, Max);
+		for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+			for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+				for (int32 X = Min.X; X <= Max.X; ++X)
+				{
+					CellRooms[Counts[X + GridDims.X * (Y + GridDims.Y * Z)]++] = R;
+				}
+	}
+
+	// ---------- Priority order inside each cell ----------
+	// Higher Priority first; on ties the smaller (more specific) volume wins.
+	auto Before = [this](int32 A, int32 B)
+		{
+			const int32 PA = Rooms[A]->Priority;
+			const int32 PB = Rooms[B]->Priority;
+			if (PA != PB) return PA > PB;
+
+			const double VA = Boxes[A].Extent.X * Boxes[A].Extent.Y * Boxes[A].Extent.Z;
+			const double VB = Boxes[B].Extent.X * Boxes[B].Extent.Y * Boxes[B].Extent.Z;
+			if (VA != VB) return VA < VB;
+
+			return A < B;
+		};
+
+	for (int32 C = 0; C < NumCells; ++C)
+	{
+		const int32 Num = CellStart[C + 1] - CellStart[C];
+		if (Num > 1)
+		{
+			Algo::Sort(MakeArrayView(CellRooms.GetData() + CellStart[C], Num), Before);
+		}
+	}
+
+	UE_LOG(LogSFWRooms, Log, TEXT("[RoomSubsystem] Built %d rooms, grid %dx%dx%d @ %.0fuu (%d entries)"),
+		Rooms.Num(), GridDims.X, GridDims.Y, GridDims.Z, GridCellSize, CellRooms.Num());
+
+	BuildGraph();
+}
+
+void USFW_RoomSubsystem::BuildGraph()
+{
+	EdgeStart.Reset();
+	EdgeTo.Reset();
+	EdgeDoor.Reset();
+	EdgeOpen.Reset();
+	RoomGroup.Reset();
+	GroupStart.Reset();
+	GroupRooms.Reset();
+	HopDistance.Reset();
+	Doors.Reset();
+	DoorToIndex.Reset();
+	DoorEdges.Reset();
+
+	UWorld* World = GetWorld();
+	const int32 NumRooms = Rooms.Num();
+	if (!World || NumRooms == 0) return;
+
+	// ---------- Volumes -> logical rooms (shared RoomId) ----------
+	RoomGroup.SetNumUninitialized(NumRooms);
+	{
+		TMap<FName, int32> GroupById;
+		int32 NumGroups = 0;
+		for (int32 R = 0; R < NumRooms; ++R)
+		{
+			const FName Id = Rooms[R] ? Rooms[R]->RoomId : NAME_None;
+			const int32* Found = Id.IsNone() ? nullptr : GroupById.Find(Id);
+			if (Found)
+			{
+				RoomGroup[R] = *Found;
+				continue;
+			}
+
+			RoomGroup[R] = NumGroups;
+			if (!Id.IsNone())
+			{
+				GroupById.Add(Id, NumGroups);
+			}
+			++NumGroups;
+		}
+
+		GroupStart.SetNumZeroed(NumGroups + 1);
+		for (const int32 G : RoomGroup)
+		{
+			++GroupStart[G + 1];
+		}
+		for (int32 G = 0; G < NumGroups; ++G)
+		{
+			GroupStart[G + 1] += GroupStart[G];
+		}
+
+		TArray<int32> Fill(GroupStart.GetData(), NumGroups);
+		GroupRooms.SetNumUninitialized(NumRooms);
+		for (int32 R = 0; R < NumRooms; ++R)
+		{
+			GroupRooms[Fill[RoomGroup[R]]++] = R;
+		}
+	}
+
+	// ---------- Doors -> room pairs ----------
+	// Probe both horizontal axes of the frame; whichever axis lands in two
+	// different rooms is the one crossing the doorway.
+	struct FDoorLink { int32 A; int32 B; int32 Door; bool bOpen; };
+	TArray<FDoorLink> Links;
+
+	for (TActorIterator<ASFW_DoorBase> It(World); It; ++It)
+	{
+		ASFW_DoorBase* DoorActor = *It;
+		if (!DoorActor) continue;
+
+		const FTransform& T = DoorActor->GetActorTransform();
+		const FVector Origin = T.GetLocation() + FVector(0.f, 0.f, DoorProbeHeight);
+
+		int32 A = INDEX_NONE;
+		int32 B = INDEX_NONE;
+		for (const EAxis::Type Axis : { EAxis::X, EAxis::Y })
+		{
+			const FVector Dir = T.GetUnitAxis(Axis) * DoorProbeDistance;
+			A = FindRoomIndexAt(Origin + Dir);
+			B = FindRoomIndexAt(Origin - Dir);
+			if (A != INDEX_NONE && B != INDEX_NONE && A != B) break;
+			A = B = INDEX_NONE;
+		}
+
+		if (A == INDEX_NONE)
+		{
+			UE_LOG(LogSFWRooms, Verbose, TEXT("[RoomSubsystem] Door %s does not join two rooms; skipped."), *DoorActor->GetName());
+			continue;
+		}
+
+		const int32 DoorIndex = Doors.Add(DoorActor);
+		DoorToIndex.Add(DoorActor, DoorIndex);
+		Links.Add({ A, B, DoorIndex, DoorActor->GetDoorState() != EDoorState::Closed });
+	}
+
+	// ---------- CSR ----------
+	TArray<int32> Cursor;
+	Cursor.SetNumZeroed(NumRooms);
+	for (const FDoorLink& L : Links)
+	{
+		++Cursor[L.A];
+		++Cursor[L.B];
+	}
+
+	EdgeStart.SetNumUninitialized(NumRooms + 1);
+	int32 Running = 0;
+	for (int32 R = 0; R < NumRooms; ++R)
+	{
+		EdgeStart[R] = Running;
+		Running += Cursor[R];
+		Cursor[R] = EdgeStart[R];
+	}
+	EdgeStart[NumRooms] = Running;
+
+	EdgeTo.SetNumUninitialized(Running);
+	EdgeDoor.SetNumUninitialized(Running);
+	EdgeOpen.Init(false, Running);
+	DoorEdges.SetNumUninitialized(Doors.Num() * 2);
+
+	for (const FDoorLink& L : Links)
+	{
+		const int32 EA = Cursor[L.A]++;
+		EdgeTo[EA] = L.B;
+		EdgeDoor[EA] = L.Door;
+		EdgeOpen[EA] = L.bOpen;
+
+		const int32 EB = Cursor[L.B]++;
+		EdgeTo[EB] = L.A;
+		EdgeDoor[EB] = L.Door;
+		EdgeOpen[EB] = L.bOpen;
+
+		DoorEdges[L.Door * 2] = EA;
+		DoorEdges[L.Door * 2 + 1] = EB;
+	}
+
+	// ---------- All-pairs hops (BFS per logical room) ----------
+	const int32 NumGroups = GetNumGroups();
+	HopDistance.Init(UnreachableHops, NumGroups * NumGroups);
+	TArray<int32> Queue;
+	Queue.Reserve(NumGroups);
+
+	for (int32 Src = 0; Src < NumGroups; ++Src)
+	{
+		uint8* Row = HopDistance.GetData() + Src * NumGroups;
+		Row[Src] = 0;
+
+		Queue.Reset();
+		Queue.Add(Src);
+		for (int32 Head = 0; Head < Queue.Num(); ++Head)
+		{
+			const int32 G = Queue[Head];
+			const uint8 Next = (uint8)FMath::Min<int32>(Row[G] + 1, UnreachableHops - 1);
+			for (int32 M = GroupStart[G]; M < GroupStart[G + 1]; ++M)
+			{
+				const int32 R = GroupRooms[M];
+				for (int32 E = EdgeStart[R]; E < EdgeStart[R + 1]; ++E)
+				{
+					const int32 To = RoomGroup[EdgeTo[E]];
+					if (Row[To] == UnreachableHops)
+					{
+						Row[To] = Next;
+						Queue.Add(To);
+					}
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogSFWRooms, Log, TEXT("[RoomSubsystem] Room graph: %d volumes in %d rooms, %d doors, %d edges"),
+		NumRooms, NumGroups, Doors.Num(), EdgeTo.Num());
+}
+
+int32 USFW_RoomSubsystem::GetRoomIndexById(FName RoomId) const
+{
+	if (RoomId.IsNone()) return INDEX_NONE;
+
+	for (int32 R = 0; R < Rooms.Num(); ++R)
+	{
+		if (Rooms[R] && Rooms[R]->RoomId == RoomId)
+		{
+			return R;
+		}
+	}
+	return INDEX_NONE;
+}
+
+TConstArrayView<int32> USFW_RoomSubsystem::GetRoomsSharingId(int32 Room) const
+{
+	if (!RoomGroup.IsValidIndex(Room))
+	{
+		return TConstArrayView<int32>();
+	}
+
+	const int32 G = RoomGroup[Room];
+	return MakeArrayView(GroupRooms.GetData() + GroupStart[G], GroupStart[G + 1] - GroupStart[G]);
+}
+
+void USFW_RoomSubsystem::GetNeighborRooms(int32 Room, bool bOpenOnly, TArray<int32>& OutRooms) const
+{
+	OutRooms.Reset();
+	if (!RoomGroup.IsValidIndex(Room) || EdgeStart.Num() != Rooms.Num() + 1) return;
+
+	const int32 Self = RoomGroup[Room];
+	for (const int32 From : GetRoomsSharingId(Room))
+	{
+		for (int32 E = EdgeStart[From]; E < EdgeStart[From + 1]; ++E)
+		{
+			if (bOpenOnly && !EdgeOpen[E]) continue;
+			if (RoomGroup[EdgeTo[E]] == Self) continue; // door inside one logical room
+
+			for (const int32 N : GetRoomsSharingId(EdgeTo[E]))
+			{
+				OutRooms.AddUnique(N);
+			}
+		}
+	}
+}
+
+int32 USFW_RoomSubsystem::GetHopDistance(int32 FromRoom, int32 ToRoom) const
+{
+	const int32 NG = GetNumGroups();
+	if (!RoomGroup.IsValidIndex(FromRoom) || !RoomGroup.IsValidIndex(ToRoom) || HopDistance.Num() != NG * NG)
+	{
+		return UnreachableHops;
+	}
+	return HopDistance[RoomGroup[FromRoom] * NG + RoomGroup[ToRoom]];
+}
+
+int32 USFW_RoomSubsystem::GetOpenHopDistance(int32 FromRoom, int32 ToRoom) const
+{
+	const int32 NG = GetNumGroups();
+	if (!RoomGroup.IsValidIndex(FromRoom) || !RoomGroup.IsValidIndex(ToRoom) || EdgeStart.Num() != Rooms.Num() + 1)
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 FromGroup = RoomGroup[FromRoom];
+	const int32 ToGroup = RoomGroup[ToRoom];
+	if (FromGroup == ToGroup) return 0;
+
+	// Closed doors can only lengthen a route, so a structurally unreachable room stays unreachable.
+	if (GetHopDistance(FromRoom, ToRoom) == UnreachableHops) return INDEX_NONE;
+
+	TArray<int32, TInlineAllocator<64>> Dist;
+	Dist.Init(INDEX_NONE, NG);
+	TArray<int32, TInlineAllocator<64>> Queue;
+	Dist[FromGroup] = 0;
+	Queue.Add(FromGroup);
+
+	for (int32 Head = 0; Head < Queue.Num(); ++Head)
+	{
+		const int32 G = Queue[Head];
+		for (int32 M = GroupStart[G]; M < GroupStart[G + 1]; ++M)
+		{
+			const int32 R = GroupRooms[M];
+			for (int32 E = EdgeStart[R]; E < EdgeStart[R + 1]; ++E)
+			{
+				const int32 To = RoomGroup[EdgeTo[E]];
+				if (!EdgeOpen[E] || Dist[To] != INDEX_NONE) continue;
+
+				Dist[To] = Dist[G] + 1;
+				if (To == ToGroup) return Dist[To];
+				Queue.Add(To);
+			}
+		}
+	}
+	return INDEX_NONE;
+}
+
+int32 USFW_RoomSubsystem::GetRoomHopDistance(FName FromRoomId, FName ToRoomId, bool bOpenDoorsOnly) const
+{
+	const int32 From = GetRoomIndexById(FromRoomId);
+	const int32 To = GetRoomIndexById(ToRoomId);
+	if (bOpenDoorsOnly)
+	{
+		return GetOpenHopDistance(From, To);
+	}
+
+	const int32 Hops = GetHopDistance(From, To);
+	return Hops == UnreachableHops ? INDEX_NONE : Hops;
+}
+
+int32 USFW_RoomSubsystem::GetDoorIndex(const ASFW_DoorBase* InDoor) const
+{
+	const int32* Found = InDoor ? DoorToIndex.Find(InDoor) : nullptr;
+	return Found ? *Found : INDEX_NONE;
+}
+
+void USFW_RoomSubsystem::SetDoorOpen(const ASFW_DoorBase* InDoor, bool bOpen)
+{
+	const int32 D = GetDoorIndex(InDoor);
+	if (D == INDEX_NONE) return;
+
+	const int32 EA = DoorEdges[D * 2];
+	if (EdgeOpen[EA] == bOpen) return;
+
+	EdgeOpen[EA] = bOpen;
+	EdgeOpen[DoorEdges[D * 2 + 1]] = bOpen;
+	OnDoorChanged.Broadcast(D, bOpen);
+}
+
+int32 USFW_RoomSubsystem::CellIndexFor(const FVector& P) const
+{
+	if (CellStart.Num() == 0 || !GridBounds.IsInsideOrOn(P))
+	{
+		return INDEX_NONE;
+	}
+
+	const FVector L = (P - GridBounds.Min) / GridCellSize;
+	const int32 X = FMath::Min(FMath::FloorToInt(L.X), GridDims.X - 1);
+	const int32 Y = FMath::Min(FMath::FloorToInt(L.Y), GridDims.Y - 1);
+	const int32 Z = FMath::Min(FMath::FloorToInt(L.Z), GridDims.Z - 1);
+	return X + GridDims.X * (Y + GridDims.Y * Z);
+}
+
+int32 USFW_RoomSubsystem::FindRoomIndexAt(const FVector& Location) const
+{
+	const int32 Cell = CellIndexFor(Location);
+	if (Cell == INDEX_NONE)
+	{
+		return INDEX_NONE;
+	}
+
+	for (int32 i = CellStart[Cell]; i < CellStart[Cell + 1]; ++i)
+	{
+		const int32 R = CellRooms[i];
+		if (Boxes[R].Contains(Location))
+		{
+			return R;
+		}
+	}
+	return INDEX_NONE;
+}
+
+ARoomVolume* USFW_RoomSubsystem::FindRoomAt(const FVector& Location) const
+{
+	const int32 R = FindRoomIndexAt(Location);
+	return R != INDEX_NONE ? Rooms[R].Get() : nullptr;
+}
+
+FName USFW_RoomSubsystem::FindRoomIdAt(const FVector& Location) const
+{
+	const ARoomVolume* Vol = FindRoomAt(Location);
+	return Vol ? Vol->RoomId : NAME_None;
+}
+
+void USFW_RoomSubsystem::FindRoomsAt(TConstArrayView<FVector> Points, TArray<ARoomVolume*>& OutRooms) const
+{
+	OutRooms.SetNumUninitialized(Points.Num());
+	for (int32 i = 0; i < Points.Num(); ++i)
+	{
+		const int32 R = FindRoomIndexAt(Points[i]);
+		OutRooms[i] = R != INDEX_NONE ? Rooms[R].Get() : nullptr;
+	}
+}
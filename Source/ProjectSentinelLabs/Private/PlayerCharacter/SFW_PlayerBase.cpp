@@ -10,6 +10,7 @@
 #include "Core/Actors/Interface/SFW_InteractableInterface.h"
 #include "Core/Components/SFW_EquipmentManagerComponent.h"
 #include "Core/Interact/SFW_InteractionComponent.h"
+#include "Core/Game/SFW_GameState.h"
 
 ASFW_PlayerBase::ASFW_PlayerBase()
 {
@@ -174,6 +175,12 @@ void ASFW_PlayerBase::PossessedBy(AController* NewController)
 {
 	Super::PossessedBy(NewController);
 	UpdateMeshVisibility();
+
+	// Spawn overlaps fire before possession; volumes holding us as pending flag us now.
+	if (ASFW_GameState* GS = GetWorld() ? GetWorld()->GetGameState<ASFW_GameState>() : nullptr)
+	{
+		GS->OnOccupantPossessed.Broadcast(this);
+	}
 }
 
 void ASFW_PlayerBase::OnRep_Controller()
@@ -241,7 +248,7 @@ void ASFW_PlayerBase::EquipSlot1(const FInputActionValue& Value)
 {
 	if (EquipmentManager)
 	{
-		EquipmentManager->Server_EquipSlot(0);
+		EquipmentManager->EquipSlot(0);
 	}
 }
 
@@ -249,7 +256,7 @@ void ASFW_PlayerBase::EquipSlot2(const FInputActionValue& Value)
 {
 	if (EquipmentManager)
 	{
-		EquipmentManager->Server_EquipSlot(1);
+		EquipmentManager->EquipSlot(1);
 	}
 }
 
@@ -257,7 +264,7 @@ void ASFW_PlayerBase::EquipSlot3(const FInputActionValue& Value)
 {
 	if (EquipmentManager)
 	{
-		EquipmentManager->Server_EquipSlot(2);
+		EquipmentManager->EquipSlot(2);
 	}
 }
 
@@ -281,16 +288,6 @@ void ASFW_PlayerBase::UpdateMeshVisibility()
 	}
 }
 
-void ASFW_PlayerBase::Server_Interact_Implementation(AActor* Target)
-{
-	if (!IsValid(Target)) return;
-
-	if (Target->GetClass()->ImplementsInterface(USFW_InteractableInterface::StaticClass()))
-	{
-		ISFW_InteractableInterface::Execute_Interact(Target, Controller); // server-side action
-	}
-}
-
 void ASFW_PlayerBase::TryInteract()
 {
 	if (Interaction)
@@ -320,7 +317,7 @@ void ASFW_PlayerBase::PlaceStarted(const FInputActionValue& Value)
 {
 	if (EquipmentManager)
 	{
-		EquipmentManager->Server_PlaceActive();
+		EquipmentManager->PlaceActive();
 	}
 }
 
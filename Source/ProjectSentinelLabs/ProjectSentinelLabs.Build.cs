@@ -20,7 +20,9 @@ public class ProjectSentinelLabs : ModuleRules
 			"UMG",
 			"Slate",
 			"NavigationSystem",
-            "AnimGraphRuntime"
+            "AnimGraphRuntime",
+			"ReplicationGraph",
+			"NetCore"
 
         });
 
@@ -0,0 +1,155 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_PatrolGraphSubsystem.generated.h"
+
+class ATargetPoint;
+
+/** One patrol point, tagged with the room it stands in. */
+struct FSFWPatrolNode
+{
+	TWeakObjectPtr<ATargetPoint> Point;
+	FVector Location = FVector::ZeroVector;
+
+	/** USFW_RoomSubsystem room index, INDEX_NONE outside every room. */
+	int32 Room = INDEX_NONE;
+};
+
+/**
+ * Patrol graph over every ATargetPoint in the level, built on the server at world begin play
+ * and again whenever USFW_RoomSubsystem rebuilds (only Shade controllers query it).
+ * - Each point is linked to its nearest points in the same room or a room one door away.
+ * - The navmesh path of every link is computed once and cached as a point list, so a patrol
+ *   leg is a RequestMove with a ready path instead of a fresh pathfinding query. Those queries
+ *   are time-sliced over the first ticks (and wait out a navmesh build); a link is unusable
+ *   until its path is in.
+ * - Links crossing a door remember it. The door's state gates the link, and a door change
+ *   (USFW_RoomSubsystem::OnDoorChanged) re-queries only that door's links, a few per tick.
+ * - Next point choice is weighted toward rooms near players (GameState occupancy + room hops).
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_PatrolGraphSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_PatrolGraphSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Build now if not built yet (or the room graph was rebuilt since). Paths follow over later ticks. */
+	void EnsureBuilt();
+
+	bool IsBuilt() const { return bBuilt; }
+
+	int32 GetNumNodes() const { return Nodes.Num(); }
+	const FSFWPatrolNode& GetNode(int32 Node) const { return Nodes[Node]; }
+
+	/** Closest node, preferring ones in the same room as Location. INDEX_NONE if the graph is empty. */
+	int32 FindNearestNode(const FVector& Location) const;
+
+	/**
+	 * Weighted pick among From's usable links. Avoids stepping straight back to Previous
+	 * unless it is the only way on. INDEX_NONE if From has no usable link right now.
+	 */
+	int32 ChooseNextNode(int32 From, int32 Previous) const;
+
+	/** Cached path points From -> To, or null if not linked / not usable right now. */
+	const TArray<FVector>* FindPath(int32 From, int32 To) const;
+
+	/** Node in Room farthest from every Avoid point (eg, player pawns). INDEX_NONE if Room has no node. */
+	int32 FindNodeInRoomAwayFrom(int32 Room, TConstArrayView<FVector> Avoid) const;
+
+	/** Door hops from Room to the nearest room holding a player; INDEX_NONE if none / unknown. */
+	int32 GetActivityHops(int32 Room) const;
+
+	/** Pick weight for a room given player activity (same weighting as ChooseNextNode). */
+	float GetActivityWeight(int32 Room) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Links per node (nearest first, before symmetrizing). */
+	int32 MaxLinksPerNode = 4;
+
+	/** Straight-line cutoff for a link (uu). */
+	float MaxLinkDistance = 3000.f;
+
+	/** Extra weight for nodes in / near rooms with players: Weight = 1 + ActivityWeight / (1 + Hops). */
+	float ActivityWeight = 4.f;
+
+	/** Chance-reducing factor for going straight back to the previous node. */
+	float BacktrackWeight = 0.1f;
+
+	/** Dirty links re-queried per tick after a door change. */
+	int32 RepathBudgetPerTick = 2;
+
+	/** Link paths computed per tick while the graph is first being filled in. */
+	int32 BuildBudgetPerTick = 8;
+
+private:
+	struct FLink
+	{
+		int32 From = INDEX_NONE;
+		int32 To = INDEX_NONE;
+
+		/** Same link in the other direction. */
+		int32 Reverse = INDEX_NONE;
+
+		/** USFW_RoomSubsystem door index this link crosses, INDEX_NONE if none. */
+		int32 Door = INDEX_NONE;
+
+		TArray<FVector> PathPoints;
+		bool bHasPath = false;
+		bool bDirty = false;
+	};
+
+	TArray<FSFWPatrolNode> Nodes;
+
+	// Links (CSR): links of node N are [LinkStart[N], LinkStart[N + 1]).
+	TArray<int32> LinkStart;
+	TArray<FLink> Links;
+
+	/** Open state per door index, mirrored from the room graph. */
+	TBitArray<> DoorOpen;
+
+	/** Door index -> links crossing it (one direction each; Reverse gets the other). */
+	TMultiMap<int32, int32> DoorLinks;
+
+	/** Forward links waiting for a re-query. */
+	TArray<int32> RepathQueue;
+
+	/** Forward links waiting for their first path and door. */
+	TArray<int32> BuildQueue;
+	int32 NumMissingPaths = 0;
+
+	bool bBuilt = false;
+	uint32 RoomBuildSerial = 0;
+
+	FDelegateHandle DoorChangedHandle;
+	FDelegateHandle RoomsRebuiltHandle;
+	FTimerHandle RepathTimer;
+	FTimerHandle BuildTimer;
+
+	/** Nodes and links only; queues every link for ProcessBuildQueue. */
+	void Build();
+	void Reset();
+
+	void ProcessBuildQueue();
+
+	bool IsLinkUsable(const FLink& Link) const;
+
+	/** Sync navmesh query for Link (and its reverse). Build and repath queues only, a few per tick. */
+	bool ComputeLinkPath(int32 LinkIndex);
+
+	/** Door between the two rooms of Link that its path passes closest to. */
+	int32 FindLinkDoor(const FLink& Link) const;
+
+	void HandleDoorChanged(int32 DoorIndex, bool bOpen);
+	void ProcessRepathQueue();
+};
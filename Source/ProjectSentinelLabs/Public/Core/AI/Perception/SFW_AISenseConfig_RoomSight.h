@@ -0,0 +1,39 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Perception/AISenseConfig.h"
+#include "Core/AI/Perception/SFW_AISense_RoomSight.h"
+#include "SFW_AISenseConfig_RoomSight.generated.h"
+
+/** Per-listener tuning for USFW_AISense_RoomSight. */
+UCLASS(meta = (DisplayName = "AI Room Sight config"))
+class PROJECTSENTINELLABS_API USFW_AISenseConfig_RoomSight : public UAISenseConfig
+{
+	GENERATED_BODY()
+
+public:
+	USFW_AISenseConfig_RoomSight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual TSubclassOf<UAISense> GetSenseImplementation() const override;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Sense", NoClear, config)
+	TSubclassOf<USFW_AISense_RoomSight> Implementation;
+
+	/** Max distance to spot a player. */
+	UPROPERTY(EditDefaultsOnly, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0))
+	float SightRadius = 2000.f;
+
+	/** Seen players are kept until they pass this distance (> SightRadius). */
+	UPROPERTY(EditDefaultsOnly, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0))
+	float LoseSightRadius = 2300.f;
+
+	/** Half angle from the view direction. */
+	UPROPERTY(EditDefaultsOnly, Category = "Sense", config, meta = (UIMin = 0.0, ClampMin = 0.0, UIMax = 180.0, ClampMax = 180.0))
+	float PeripheralVisionAngleDegrees = 80.f;
+
+	/** How often this listener's candidate set is rebuilt from room occupancy (s). */
+	UPROPERTY(EditDefaultsOnly, Category = "Sense", config, meta = (UIMin = 0.05, ClampMin = 0.05))
+	float CandidateRefreshInterval = 0.2f;
+};
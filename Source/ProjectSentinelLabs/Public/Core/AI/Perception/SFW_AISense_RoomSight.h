@@ -0,0 +1,75 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Perception/AISense.h"
+#include "SFW_AISense_RoomSight.generated.h"
+
+class APawn;
+class USFW_AISenseConfig_RoomSight;
+
+/**
+ * Sight for the Shade, driven by the room graph instead of registered stimulus sources.
+ * - Candidates per listener come from ASFW_GameState room occupancy: the listener's room plus
+ *   rooms one open door away (USFW_RoomSubsystem). Players anywhere else are never considered.
+ * - Candidates passing range / view cone queue a visibility trace; all listeners share one
+ *   per-update trace budget, so cost stays flat with more Shades and players.
+ * - Reports gain / loss through the normal perception stimulus path (OnTargetPerceptionUpdated).
+ */
+UCLASS(ClassGroup = AI)
+class PROJECTSENTINELLABS_API USFW_AISense_RoomSight : public UAISense
+{
+	GENERATED_BODY()
+
+public:
+	USFW_AISense_RoomSight(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+protected:
+	virtual float Update() override;
+
+	void OnNewListenerImpl(const FPerceptionListener& NewListener);
+	void OnListenerUpdateImpl(const FPerceptionListener& UpdatedListener);
+	void OnListenerRemovedImpl(const FPerceptionListener& RemovedListener);
+
+	/** Visibility traces per update, shared by every listener. */
+	UPROPERTY(EditDefaultsOnly, Category = "AI Perception", config)
+	int32 MaxTracesPerUpdate = 6;
+
+private:
+	struct FListenerState
+	{
+		float SightRadiusSq = 0.f;
+		float LoseSightRadiusSq = 0.f;
+		float CosHalfFOV = 0.f;
+		float RefreshInterval = 0.2f;
+		float NextRefreshTime = 0.f;
+
+		/** Players currently reported as seen. */
+		TArray<TWeakObjectPtr<AActor>> Seen;
+	};
+
+	struct FPendingTrace
+	{
+		FPerceptionListenerID ListenerId;
+		TWeakObjectPtr<AActor> Target;
+	};
+
+	TMap<FPerceptionListenerID, FListenerState> ListenerStates;
+
+	/** FIFO of visibility checks, drained MaxTracesPerUpdate at a time. */
+	TArray<FPendingTrace> TraceQueue;
+	int32 TraceQueueHead = 0;
+
+	/** Scratch: occupancy slot -> player pawn, rebuilt once per update. */
+	TArray<APawn*, TInlineAllocator<32>> SlotPawns;
+
+	void ApplyConfig(const FPerceptionListener& Listener, FListenerState& State) const;
+	void BuildSlotPawns();
+
+	/** Room / range / cone pass for one listener; queues traces, reports cheap losses. */
+	void RefreshCandidates(FPerceptionListener& Listener, FListenerState& State);
+
+	void QueueTrace(const FPerceptionListenerID& ListenerId, AActor* Target);
+	void ReportSeen(FPerceptionListener& Listener, FListenerState& State, AActor* Target, bool bVisible);
+};
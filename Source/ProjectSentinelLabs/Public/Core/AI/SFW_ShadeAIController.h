@@ -7,8 +7,8 @@
 #include "SFW_ShadeAIController.generated.h"
 
 class UAIPerceptionComponent;
-class UAISenseConfig_Sight;
-class ATargetPoint;
+class USFW_AISenseConfig_RoomSight;
+class USFW_PatrolGraphSubsystem;
 class ASFW_ShadeCharacterBase;
 struct FAIStimulus;
 struct FPathFollowingResult;
@@ -53,7 +53,7 @@ protected:
 	UAIPerceptionComponent* Perception = nullptr;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "AI|Perception")
-	UAISenseConfig_Sight* SightConfig = nullptr;
+	USFW_AISenseConfig_RoomSight* SightConfig = nullptr;
 
 	UFUNCTION()
 	void OnTargetPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus);
@@ -61,10 +61,16 @@ protected:
 	virtual void OnMoveCompleted(FAIRequestID RequestID, const FPathFollowingResult& Result) override;
 
 	/** === Patrol === */
+	// Patrol points + cached leg paths; PatrolIndex / CurrentGoalIndex are graph nodes
 	UPROPERTY()
-	TArray<AActor*> PatrolPoints;
+	TObjectPtr<USFW_PatrolGraphSubsystem> PatrolGraph = nullptr;
 
 	int32 PatrolIndex = INDEX_NONE;
+	int32 PrevPatrolIndex = INDEX_NONE;
+
+	// Farther than this from PatrolIndex (after chase / search) means walk back to the nearest node first
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Patrol")
+	float PatrolRejoinDistance = 300.f;
 
 	void BuildPatrolPointList();
 	void StartPatrol();
@@ -83,6 +89,51 @@ protected:
 	bool bPatrolLegActive = false;
 	int32 CurrentGoalIndex = INDEX_NONE;
 
+	/** === Async pathing === */
+	// Every non-graph move goes through one async query at a time; newer goals overwrite the pending one
+	void RequestPathMove(const FVector& Goal, float AcceptanceRadius);
+
+	// Drop in-flight / pending queries (state switches that don't need the old goal)
+	void CancelPathRequests();
+
+	// A new goal this close to the one being followed (or queried) keeps the current path
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Pathing")
+	float PathReuseDistance = 150.f;
+
+	// Token bucket per controller: burst size and refill rate
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Pathing")
+	int32 PathRequestBurst = 2;
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Pathing")
+	float PathRequestsPerSecond = 4.0f;
+
+	// How often Chase re-checks the target's position against the current path
+	UPROPERTY(EditDefaultsOnly, Category = "AI|Pathing")
+	float ChaseRepathInterval = 0.25f;
+
+	uint32 PathQueryId = 0;            // 0 = none in flight
+	FVector PathQueryGoal = FVector::ZeroVector;
+	float PathQueryAcceptance = 0.f;
+
+	bool bHasPendingPathGoal = false;
+	FVector PendingPathGoal = FVector::ZeroVector;
+	float PendingPathAcceptance = 0.f;
+
+	bool bHasMoveGoal = false;         // MoveGoal is the goal of the path being followed
+	FVector MoveGoal = FVector::ZeroVector;
+
+	float PathTokens = 0.f;
+	float PathTokenTime = 0.f;
+
+	FTimerHandle PathRetryHandle;
+	FTimerHandle ChaseRepathHandle;
+
+	void FlushPendingPathRequest();
+	void IssuePathQuery(const FVector& Goal, float AcceptanceRadius);
+	void OnPathQueryDone(uint32 QueryId, ENavigationQueryResult::Type Result, FNavPathSharedPtr Path);
+	void OnPathRequestFailed();
+	bool ConsumePathToken();
+	void UpdateChasePath();
+
 	/** === Target Handling === */
 	UPROPERTY()
 	AActor* TargetActor = nullptr;
@@ -97,4 +148,37 @@ protected:
 
 	// Proximity check stub (wired later)
 	void TryAttackTarget();
+
+	/** === LOD === */
+	// With no player in the Shade's room or a neighbouring one, drop to an abstract simulation:
+	// pawn hidden with movement / anim / perception off, position tracked as a room that hops along the graph on a timer
+	UPROPERTY(EditDefaultsOnly, Category = "AI|LOD")
+	bool bEnableLOD = true;
+
+	UPROPERTY(EditDefaultsOnly, Category = "AI|LOD")
+	float LODCheckInterval = 0.5f;
+
+	// Players must stay away this long before going abstract
+	UPROPERTY(EditDefaultsOnly, Category = "AI|LOD")
+	float LODEnterDelay = 4.0f;
+
+	// Seconds per room hop while abstract (random in range)
+	UPROPERTY(EditDefaultsOnly, Category = "AI|LOD")
+	float AbstractHopMin = 6.0f;
+	UPROPERTY(EditDefaultsOnly, Category = "AI|LOD")
+	float AbstractHopMax = 12.0f;
+
+	bool bAbstractSim = false;
+	int32 AbstractRoom = INDEX_NONE;   // USFW_RoomSubsystem index
+	float LastPlayersNearTime = 0.f;
+
+	FTimerHandle LODCheckHandle;
+	FTimerHandle AbstractHopHandle;
+
+	void UpdateLOD();
+	bool ArePlayersNearRoom(int32 Room) const;
+	void EnterAbstractSim(int32 Room);
+	void ExitAbstractSim();
+	void AbstractHop();
+	void ScheduleAbstractHop();
 };
\ No newline at end of file
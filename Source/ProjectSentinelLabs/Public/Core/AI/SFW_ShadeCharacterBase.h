@@ -32,6 +32,11 @@ public:
     UFUNCTION(BlueprintPure, Category = "Shade")
     EShadeState GetShadeState() const { return ShadeState; }
 
+    // Server: AI LOD. Abstract = hidden, no collision, movement + anim ticks off (controller moves it on the room graph)
+    void SetAbstractSimulation(bool bAbstract);
+    UFUNCTION(BlueprintPure, Category = "Shade")
+    bool IsAbstractSimulation() const { return bAbstractSimulation; }
+
 protected:
     // --- Movement tuning
     UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Movement")
@@ -47,6 +52,14 @@ protected:
     UFUNCTION()
     void OnRep_ShadeState();
 
+    UPROPERTY(ReplicatedUsing = OnRep_AbstractSimulation, BlueprintReadOnly, Category = "State")
+    bool bAbstractSimulation = false;
+
+    UFUNCTION()
+    void OnRep_AbstractSimulation();
+
+    void ApplyAbstractSimulation();
+
     // cached 0..1
     UPROPERTY(Transient, BlueprintReadOnly, Category = "State")
     float AggressionFactor = 0.f;
@@ -7,11 +7,13 @@
 #include "SFW_DoorScareFX.generated.h"
 
 class USkeletalMeshComponent;
+class USceneComponent;
 class UAnimMontage;
 
 /**
  * Transient scare visual for door slam.
- * Spawns on server. Replicates. Plays one montage. Dies after LifetimeSec.
+ * Local only (not replicated): every machine plays it from the door's replicated SlamEvent.
+ * Owned by USFW_DoorScareFXPoolSubsystem - pre-spawned hidden, played, then parked again.
  */
 UCLASS(Blueprintable)
 class PROJECTSENTINELLABS_API ASFW_DoorScareFX : public AActor
@@ -21,18 +23,30 @@ class PROJECTSENTINELLABS_API ASFW_DoorScareFX : public AActor
 public:
 	ASFW_DoorScareFX();
 
-	/* Auto-destroy after this many seconds */
+	/* Return to the pool after this many seconds */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX")
 	float Lifetime = 1.5f;
 
+	/** Show at Where, play the montage from the start, park after InLifetime (<= 0 uses Lifetime). */
+	void PlayScare(const FTransform& Where, float InLifetime, USceneComponent* AttachTo = nullptr);
+
+	/** Hide, stop and detach. Called by the pool on spawn and on release. */
+	void ParkScare();
+
+	bool IsPlaying() const { return bPlaying; }
+
 protected:
-	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	/** Blueprint hook for extra FX (sounds, particles) each time the scare plays. */
+	UFUNCTION(BlueprintImplementableEvent, Category = "FX")
+	void OnScarePlayed();
 
 	// Mesh for the shade / figure / hands etc
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "FX")
 	USkeletalMeshComponent* ScareMesh;
 
-	// Optional montage to play once at spawn
+	// Optional montage to play once per scare
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX")
 	TObjectPtr<UAnimMontage> ScareMontage = nullptr;
 
@@ -40,7 +54,13 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX")
 	float MontagePlayRate = 1.0f;
 
-	// Lifetime in seconds before this actor auto-destroys
+	// Legacy; Lifetime / the door's ScareFXLifetime drive how long a scare shows
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "FX")
 	float LifetimeSec = 2.0f;
+
+private:
+	FTimerHandle Timer_Finish;
+	bool bPlaying = false;
+
+	void FinishScare();
 };
@@ -0,0 +1,63 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_DoorScareFXPoolSubsystem.generated.h"
+
+class ASFW_DoorScareFX;
+class USceneComponent;
+
+USTRUCT()
+struct FSFWDoorScareFXBucket
+{
+	GENERATED_BODY()
+
+	/** Hidden, parked instances ready to play. */
+	UPROPERTY()
+	TArray<TObjectPtr<ASFW_DoorScareFX>> Free;
+};
+
+/**
+ * Local per-class pool of door scare visuals.
+ * - Pre-spawned at world begin play for every ScareFXClass used by a door in the level,
+ *   so the skeletal mesh, anim instance and montage are ready before the first slam.
+ * - Instances are not replicated; each machine plays its own when the door's SlamEvent counter replicates.
+ * - Never created on dedicated servers.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_DoorScareFXPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_DoorScareFXPoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Make sure at least Count parked instances of Class exist. */
+	void Prewarm(TSubclassOf<ASFW_DoorScareFX> Class, int32 Count);
+
+	/** Play a Class scare at Where (spawns only if every instance is busy). */
+	ASFW_DoorScareFX* Play(TSubclassOf<ASFW_DoorScareFX> Class, const FTransform& Where, float Lifetime, USceneComponent* AttachTo = nullptr);
+
+	/** Park FX and make it available again. */
+	void Release(ASFW_DoorScareFX* FX);
+
+	int32 GetNumFree(TSubclassOf<ASFW_DoorScareFX> Class) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Instances per scare class at begin play. Scares rarely overlap; two covers a double slam. */
+	int32 PrewarmPerClass = 2;
+
+private:
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FSFWDoorScareFXBucket> Buckets;
+
+	ASFW_DoorScareFX* SpawnPooled(UClass* Class);
+};
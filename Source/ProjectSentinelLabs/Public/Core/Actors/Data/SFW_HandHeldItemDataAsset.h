@@ -9,8 +9,13 @@
 
 
 class UAnimSequence;
+class USoundBase;
+class UTextureLightProfile;
+
 /**
- * 
+ * Per item type data.
+ * Presentation assets are soft: USFW_ItemAssetSubsystem streams them in while a player
+ * holds an item of this type and lets them go when nobody does.
  */
 UCLASS()
 class PROJECTSENTINELLABS_API USFW_HandHeldItemDataAsset : public UDataAsset
@@ -37,10 +42,23 @@ public:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item | Behavior", meta=(EditCondition="bHasLight"))
 	float LightIntensityTP = 2000.f;
 
+	// ---------- Presentation (soft) ----------
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item | Presentation", meta=(EditCondition="bHasLight"))
+	TSoftObjectPtr<UTextureLightProfile> IESProfile;
 
+	/** Power / toggle on one-shot. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item | Presentation")
+	TSoftObjectPtr<USoundBase> PowerOnSFX;
 
+	/** Power / toggle off one-shot. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item | Presentation")
+	TSoftObjectPtr<USoundBase> PowerOffSFX;
 
+	/** Primary use one-shot (camera shutter etc). */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Item | Presentation")
+	TSoftObjectPtr<USoundBase> UseSFX;
 
-
+	/** Every non-null presentation asset path. */
+	void GetPresentationAssets(TArray<FSoftObjectPath>& OutPaths) const;
 };
@@ -0,0 +1,54 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_ItemAssetSubsystem.generated.h"
+
+class USFW_HandHeldItemDataAsset;
+
+/**
+ * Ref-counted async streaming of item presentation assets (IES, SFX).
+ * - One holder per equippable currently owned by a player on this peer.
+ * - First Retain streams the source's soft refs; last Release drops the handle.
+ * - Sources are item data assets, or an equippable class for its legacy fallbacks.
+ * - Never loads on a dedicated server.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_ItemAssetSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_ItemAssetSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	/** Add a holder for Data. OnLoaded fires once the assets are in (immediately if already resident). */
+	void Retain(const USFW_HandHeldItemDataAsset* Data, FSimpleDelegate OnLoaded);
+
+	/** Add a holder for Source's soft refs (Paths are only read by the first holder). */
+	void Retain(const UObject* Source, TArray<FSoftObjectPath> Paths, FSimpleDelegate OnLoaded);
+
+	/** Remove a holder; the last one releases the streamed assets. */
+	void Release(const UObject* Source);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	struct FEntry
+	{
+		int32 Holders = 0;
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FSimpleDelegate> Waiting;
+	};
+
+	FStreamableManager Streamable;
+	TMap<TObjectKey<UObject>, FEntry> Entries;
+
+	void HandleLoaded(TObjectKey<UObject> Key);
+};
@@ -0,0 +1,136 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/Actors/SFW_EquippableBase.h"
+#include "SFW_DeviceBase.generated.h"
+
+class UStaticMeshComponent;
+class UAudioComponent;
+
+/** Who hears a device's loop / power clicks. */
+UENUM(BlueprintType)
+enum class ESFWDeviceAudience : uint8
+{
+	None        UMETA(DisplayName = "Nobody"),
+	LocalHolder UMETA(DisplayName = "Local Holder"),  // only the player holding it in hand
+	Everyone    UMETA(DisplayName = "Everyone")
+};
+
+/** Replicated power state shared by all devices. One push-model property per device. */
+USTRUCT(BlueprintType)
+struct FSFWDevicePower
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Device")
+	bool bOn = false;
+
+	/** Device-defined reading (EMF LEDs, ...). Reset to 0 on power off. */
+	UPROPERTY(BlueprintReadOnly, Category = "Device")
+	uint8 Level = 0;
+};
+
+/**
+ * Shared core for handheld devices.
+ * - DeviceMesh is the root, the visual and the drop body. It is not component-replicated;
+ *   ReplicatedMovement already carries the root, so there is no skeletal mesh underneath.
+ * - Power / level live in one replicated struct; subclasses react in OnPowerChanged / OnLevelChanged.
+ * - LoopAudio plays while powered for LoopAudience; power clicks go to PowerSFXAudience.
+ */
+UCLASS(Abstract)
+class PROJECTSENTINELLABS_API ASFW_DeviceBase : public ASFW_EquippableBase
+{
+	GENERATED_BODY()
+
+public:
+	ASFW_DeviceBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
+
+	virtual void BeginPlay() override;
+
+	// Equippable: holder / visibility changes re-evaluate the loop
+	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
+	virtual void OnUnequipped() override;
+	virtual void OnDropped(const FVector& DropLocation, const FVector& TossVelocity) override;
+	virtual void OnPlaced(const FTransform& WorldTransform) override;
+	virtual void OnReturnedToPool() override;
+	virtual UStaticMesh* GetPlacementPreviewMesh() const override;
+
+	// ---------- Power ----------
+
+	/** Any machine; clients forward to the server. */
+	UFUNCTION(BlueprintCallable, Category = "Device")
+	void SetPowered(bool bEnable);
+
+	UFUNCTION(BlueprintCallable, Category = "Device")
+	void TogglePower() { SetPowered(!Power.bOn); }
+
+	UFUNCTION(BlueprintPure, Category = "Device")
+	bool IsPowered() const { return Power.bOn; }
+
+	UFUNCTION(BlueprintPure, Category = "Device")
+	int32 GetLevel() const { return Power.Level; }
+
+	/** Server only. Clamped to 0..255. */
+	void SetLevel(int32 NewLevel);
+
+protected:
+	/**
+	 * Create DeviceMesh / LoopAudio. Every subclass constructor calls this first, passing the
+	 * subobject names its components had before the base existed, so Blueprint overrides
+	 * (mesh, materials, loop sound) keep binding by name.
+	 */
+	void CreateDeviceComponents(FName MeshName, FName LoopAudioName = TEXT("LoopAudio"));
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Device")
+	TObjectPtr<UStaticMeshComponent> DeviceMesh;
+
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Device|Audio")
+	TObjectPtr<UAudioComponent> LoopAudio;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Device|Audio")
+	ESFWDeviceAudience LoopAudience = ESFWDeviceAudience::LocalHolder;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Device|Audio")
+	ESFWDeviceAudience PowerSFXAudience = ESFWDeviceAudience::LocalHolder;
+
+	UPROPERTY(ReplicatedUsing = OnRep_Power, BlueprintReadOnly, Category = "Device")
+	FSFWDevicePower Power;
+
+	UFUNCTION()
+	void OnRep_Power();
+
+	UFUNCTION(Server, Reliable)
+	void Server_SetPowered(bool bEnable);
+
+	/** Power flipped (every machine; also once at BeginPlay with the initial state). */
+	virtual void OnPowerChanged(bool bOn) {}
+
+	/** Level changed (every machine; also once at BeginPlay). */
+	virtual void OnLevelChanged(int32 NewLevel) {}
+
+	/** Loop should be audible on this machine right now. */
+	virtual bool ShouldPlayLoop() const;
+
+	/** Start / stop LoopAudio to match ShouldPlayLoop(). Cheap; call after anything that changes it. */
+	void UpdateLoopAudio();
+
+	/** In hand (visible, attached) of the locally controlled player. */
+	bool IsHeldLocally() const;
+
+	bool IsAudibleTo(ESFWDeviceAudience Audience) const;
+
+private:
+	/** Diff Power against what this machine last applied and fire the hooks. */
+	void RefreshPowerState();
+
+	FSFWDevicePower AppliedPower;
+	bool bPowerApplied = false;
+
+	/** Power off on pool return: no click here (clients get it together with bHidden). */
+	bool bSuppressPowerSFX = false;
+
+public:
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+};
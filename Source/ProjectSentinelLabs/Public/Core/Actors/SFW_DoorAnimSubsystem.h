@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_DoorAnimSubsystem.generated.h"
+
+class ASFW_DoorBase;
+class UStaticMeshComponent;
+
+/**
+ * Runs every swinging door in one tick.
+ * - Moving doors live in parallel arrays (start time, start yaw, target yaw, duration).
+ * - Yaw is evaluated analytically from the replicated server start time, so every machine
+ *   shows the same angle no matter when the state arrived.
+ * - One pass evaluates all yaws, one pass writes the leaves whose yaw changed since the
+ *   last write; finished doors are retired after.
+ * - Runs on the server too (leaves collide, and the server settles Opening -> Open).
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_DoorAnimSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_DoorAnimSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Doors.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	/** Start (or retarget) Door's swing. StartTime is server world time. */
+	void AddDoor(ASFW_DoorBase* Door, float StartTime, float StartYaw, float TargetYaw, float Duration);
+
+	/** Stop animating Door; leaves the leaf where it is. */
+	void RemoveDoor(ASFW_DoorBase* Door);
+
+	int32 GetNumMovingDoors() const { return Doors.Num(); }
+
+	/** Server world time as seen on this machine. */
+	float GetServerTime() const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// ---------- Parallel arrays, one entry per moving door ----------
+	TArray<TWeakObjectPtr<ASFW_DoorBase>> Doors;
+	TArray<TWeakObjectPtr<UStaticMeshComponent>> Leaves;
+	TArray<float> StartTimes;
+	TArray<float> StartYaws;
+	TArray<float> TargetYaws;
+	TArray<float> InvDurations;
+
+	/** Yaw last written to each leaf, so unchanged leaves skip the component update. */
+	TArray<float> WrittenYaws;
+
+	/** Scratch: evaluated alpha per slot, then yaw in place. */
+	TArray<float> Scratch;
+
+	/** Scratch: doors that reached their target this tick. */
+	TArray<TWeakObjectPtr<ASFW_DoorBase>> Finished;
+
+	void RemoveAt(int32 Slot);
+};
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "Core/AnomalySystems/SFW_DecisionTypes.h"
+#include "Core/Net/SFW_CosmeticEvent.h"
 #include "SFW_DoorBase.generated.h"
 
 class USceneComponent;
@@ -25,6 +26,21 @@ enum class EDoorState : uint8
 	Closing UMETA(DisplayName = "Closing"),
 };
 
+/** When / where the current swing started. Replicated alongside State so every machine evaluates the same curve. */
+USTRUCT()
+struct FSFWDoorMotion
+{
+	GENERATED_BODY()
+
+	/** Server world time the swing began. */
+	UPROPERTY()
+	float StartTime = 0.f;
+
+	/** Leaf yaw on the server at StartTime (mid-swing reversals start from here). */
+	UPROPERTY()
+	float StartYaw = 0.f;
+};
+
 UCLASS(Blueprintable)
 class PROJECTSENTINELLABS_API ASFW_DoorBase : public AActor
 {
@@ -36,7 +52,6 @@ public:
 	virtual void OnConstruction(const FTransform& Transform) override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void Tick(float DeltaSeconds) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
 	// Decision-system entry
@@ -62,6 +77,11 @@ public:
 	UFUNCTION(BlueprintPure, Category = "SFW|Door")
 	FName GetRoomID() const { return RoomID; }
 
+	UFUNCTION(BlueprintPure, Category = "SFW|Door")
+	EDoorState GetDoorState() const { return State; }
+
+	TSubclassOf<ASFW_DoorScareFX> GetScareFXClass() const { return ScareFXClass; }
+
 	// Debug: force scare
 //	UFUNCTION(Exec, Server, Reliable)
 //	void Server_Debug_ForceScare(APawn* InstigatorPawn);
@@ -126,7 +146,7 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SFW|Scare")
 	float SlamImpactDelay = 0.25f;
 
-	// Replicated SFX at slam
+	// SFX at slam impact (SlamImpactDelay after the FX)
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "SFW|Scare")
 	USoundBase* SlamSFX = nullptr;
 
@@ -140,6 +160,16 @@ protected:
 	UPROPERTY(Replicated)
 	float LockEndTime = 0.f;
 
+	UPROPERTY(Replicated)
+	FSFWDoorMotion Motion;
+
+	/** Slam scare: Location = FX location, Payload = FX rotation (deg). Clients time the SFX off ServerTime. */
+	UPROPERTY(ReplicatedUsing = OnRep_SlamEvent)
+	FSFWCosmeticEvent SlamEvent;
+
+	UFUNCTION()
+	void OnRep_SlamEvent();
+
 	// Scare logic
 	UPROPERTY(EditAnywhere, Category = "SFW|Scare")
 	float ScareChance = 0.15f;
@@ -151,17 +181,22 @@ protected:
 	float ScareCooldown = 10.0f;
 
 	FTimerHandle Timer_SlamImpact;
-
-	// Motion state
-	float StartYaw = 0.f;
-	float TargetYaw = 0.f;
-	float AnimT = 0.f;
+	FTimerHandle Timer_SlamSFX;
+	FSFWCosmeticEventReceiver SlamReceiver;
 
 	// Per-door cooldown
 	float LastScareTime = -1000.f;
 
 	// Helpers
 	void ApplyState();
+
+	/** Server: write the replicated state and apply it locally. */
+	void SetState(EDoorState NewState);
+
+	/** Server: awake while moving, DORM_DormantAll once the door has settled. */
+	void UpdateNetDormancy();
+
+	/** Swing reached its target (called by USFW_DoorAnimSubsystem). Server settles the state. */
 	void FinishMotion();
 	void SnapTo(float YawDeg);
 	float GetYaw() const;
@@ -172,11 +207,13 @@ protected:
 
 	FTransform ComputeScareFXTransform() const;
 
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_PlaySlamFX(const FTransform& Where);
+	friend class USFW_DoorAnimSubsystem;
+
+	/** Slot in USFW_DoorAnimSubsystem while swinging, INDEX_NONE otherwise. Owned by the subsystem. */
+	int32 AnimSlot = INDEX_NONE;
 
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_PlaySlamSFX(const FVector& Loc);
+	void PlaySlamFX(const FTransform& Where);
+	void PlaySlamSFX();
 
 	UFUNCTION()
 	void OnProximityBegin(UPrimitiveComponent* OverlappedComp, AActor* OtherActor,
@@ -6,22 +6,19 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "TimerManager.h"
 #include "SFW_EMFDevice.generated.h"
 
-class UStaticMeshComponent;
-class UAudioComponent;
-class USoundBase;
 class UMaterialInstanceDynamic;
 
 /**
  * Handheld EMF meter.
  * PrimaryUse() toggles power on the server.
- * EMFLevel (0..5) drives LED brightness.
+ * Device level (0..5) drives LED brightness.
  */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_EMFDevice : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_EMFDevice : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -32,10 +29,6 @@ public:
 
 	// When equipped in hand
 	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
-	virtual void OnUnequipped() override;
-
-	// Optional: keep base physics drop but ensure visuals are visible when dropped
-	virtual void OnDropped(const FVector& DropLocation, const FVector& TossVelocity) override;
 
 	// Player pressed IA_Use while this is active in hand
 	virtual void PrimaryUse() override;
@@ -47,64 +40,30 @@ public:
 
 	// Blueprint-callable hard set
 	UFUNCTION(BlueprintCallable, Category = "EMF")
-	void SetActive(bool bEnable);
+	void SetActive(bool bEnable) { SetPowered(bEnable); }
 
 	UFUNCTION(BlueprintPure, Category = "EMF")
-	bool IsActive() const { return bIsActive; }
+	bool IsActive() const { return IsPowered(); }
 
-	// Client -> Server request to flip current state
-	UFUNCTION(Server, Reliable)
-	void Server_RequestToggle();
+	// ---- EMF level control ----
 
-	// Server-side authority setter (used internally)
-	UFUNCTION(Server, Reliable)
-	void Server_SetActive(bool bEnable);
+	// Spike level 0..5 (how many LEDs should glow)
+	UFUNCTION(BlueprintPure, Category = "EMF")
+	int32 GetEMFLevel() const { return GetLevel(); }
 
-	// ---- EMF level control ----
 	// Server only. Called as scan updates
-	UFUNCTION(Server, Reliable)
-	void Server_SetEMFLevel(int32 NewLevel);
+	void SetEMFLevel(int32 NewLevel) { SetLevel(FMath::Clamp(NewLevel, 0, 5)); }
 
 	/** Server-only: anomaly trigger calls this to force a temporary burst. */
 	UFUNCTION(BlueprintCallable, Category = "EMF")
 	void TriggerAnomalyBurst(int32 Level, float Seconds);
 
 protected:
-	// ---- Components ----
-
-	/** Visual body mesh. BPs attach EMF LEDs and details under this. */
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
-	UStaticMeshComponent* EMFMesh;
-
-	/** Which component should simulate physics when dropped. */
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
-
-	// Looping hum / crackle while active (owner-local)
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "EMF")
-	TObjectPtr<UAudioComponent> HumAudioComp;
-
-	// Power toggle one-shot sounds (owner-local)
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EMF|Audio")
-	TObjectPtr<USoundBase> PowerOnSFX = nullptr;
+	// ---- Device ----
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "EMF|Audio")
-	TObjectPtr<USoundBase> PowerOffSFX = nullptr;
-
-	// ---- Replicated state ----
-
-	// Power state of device
-	UPROPERTY(ReplicatedUsing = OnRep_IsActive, BlueprintReadOnly, Category = "EMF")
-	bool bIsActive = false;
-
-	UFUNCTION()
-	void OnRep_IsActive();
-
-	// Spike level 0..5 (how many LEDs should glow)
-	UPROPERTY(ReplicatedUsing = OnRep_EMFLevel, BlueprintReadOnly, Category = "EMF")
-	int32 EMFLevel = 0;
-
-	UFUNCTION()
-	void OnRep_EMFLevel();
+	// Sync scan timer and LEDs when power changes
+	virtual void OnPowerChanged(bool bOn) override;
+	virtual void OnLevelChanged(int32 NewLevel) override;
 
 	// ---- LED / visual runtime control ----
 
@@ -115,12 +74,9 @@ protected:
 	// Build LEDMIDs array by finding child StaticMeshComponents tagged "EMF_LED"
 	void CacheLEDMaterials();
 
-	// Apply brightness to each LED based on EMFLevel and bIsActive
+	// Apply brightness to each LED based on level and power
 	void UpdateLEDVisuals();
 
-	// Sync hum audio, scan timer, SFX when power changes
-	void ApplyActiveState();
-
 	// ---- Scan logic ----
 
 	// Server timer while active
@@ -129,7 +85,7 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "EMF|Scan")
 	float ScanRadius = 800.f;
 
-	// Server-side pulse. Pulls sources and burst state and mirrors into EMFLevel
+	// Server-side pulse. Pulls sources and burst state and mirrors into the device level
 	void DoServerScanForEMF();
 
 	// Temporary anomaly-controlled burst (server-only)
@@ -144,7 +100,4 @@ protected:
 	{
 		return TEXT("hand_R_EMF");
 	}
-
-public:
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
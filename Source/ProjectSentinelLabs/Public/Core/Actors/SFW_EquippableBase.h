@@ -4,6 +4,7 @@
 #include "GameFramework/Actor.h"
 #include "Core/Actors/Interface/SFW_InteractableInterface.h"
 #include "PlayerCharacter/Animation/SFW_EquipmentTypes.h"
+#include "Core/Net/SFW_CosmeticEvent.h"
 #include "SFW_EquippableBase.generated.h"
 
 class AController;
@@ -11,6 +12,10 @@ class ACharacter;
 class USkeletalMeshComponent;
 class UPrimitiveComponent;
 class UBoxComponent;
+class USoundBase;
+class UTextureLightProfile;
+class UStaticMesh;
+class USFW_HandHeldItemDataAsset;
 
 UENUM(BlueprintType)
 enum class ESFWEquipSlot : uint8
@@ -32,11 +37,21 @@ class PROJECTSENTINELLABS_API ASFW_EquippableBase
 	GENERATED_BODY()
 
 public:
-	ASFW_EquippableBase();
+	ASFW_EquippableBase(const FObjectInitializer& ObjectInitializer = FObjectInitializer::Get());
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+	/** Owner changes drive presentation asset streaming (held by a pawn = relevant). */
+	virtual void SetOwner(AActor* NewOwner) override;
+	virtual void OnRep_Owner() override;
+
+	/** Owner and hidden state pick the replication graph lists (stowed = owner only). */
+	virtual void SetActorHiddenInGame(bool bNewHidden) override;
 
 protected:
+	/** Optional skeletal root. Devices (ASFW_DeviceBase) skip it and root on their static mesh. */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Equippable")
 	TObjectPtr<USkeletalMeshComponent> Mesh;
 
@@ -48,12 +63,67 @@ protected:
 
 	bool bHasCachedPhysicsRelativeTransform = false;
 
+	/** Idle in USFW_EquippablePoolSubsystem (server only). */
+	bool bPooled = false;
+
+	/** Holding USFW_ItemAssetSubsystem references for ItemData and the class fallbacks. */
+	bool bPresentationRetained = false;
+
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Equippable")
 	ESFWEquipSlot EquipSlot;
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Equippable")
 	FText DisplayName;
 
+	/** Type data; its soft presentation assets stream in while a pawn owns this item. */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Equippable")
+	TObjectPtr<USFW_HandHeldItemDataAsset> ItemData;
+
+	// Per-class values authored before ItemData existed, used while ItemData is
+	// unset or leaves that slot empty. Soft like ItemData's and streamed with it,
+	// keyed on the class; prefer moving them into ItemData.
+
+	UPROPERTY(EditDefaultsOnly, Category = "Equippable|Presentation")
+	TSoftObjectPtr<USoundBase> PowerOnSFX;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Equippable|Presentation")
+	TSoftObjectPtr<USoundBase> PowerOffSFX;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Equippable|Presentation")
+	TSoftObjectPtr<USoundBase> UseSFX;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Equippable|Presentation")
+	TSoftObjectPtr<UTextureLightProfile> IESProfile;
+
+	// ---------- Presentation assets ----------
+	// ItemData's asset, else the fallback above, once streamed in; may be
+	// null, callers must cope (skip the sound, no IES).
+
+	UTextureLightProfile* GetIESProfile() const;
+	USoundBase* GetPowerSFX(bool bOn) const;
+	USoundBase* GetUseSFX() const;
+
+	/** Streamed assets just became available (lights re-apply IES here). */
+	virtual void OnPresentationAssetsLoaded() {}
+
+	// ---------- World event (drop / place) ----------
+
+	enum class EWorldEventType : uint8 { None = 0, Dropped = 1, Placed = 2 };
+
+	/**
+	 * Last drop / place, replicated to relevant clients instead of a multicast.
+	 * Location = drop point / placed location, Payload = toss velocity / placed rotation (deg).
+	 * Type goes back to None while held or pooled, so nothing stale is re-applied.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_WorldEvent)
+	FSFWCosmeticEvent WorldEvent;
+
+	UFUNCTION()
+	void OnRep_WorldEvent();
+
+	/** Server: held / pooled again. */
+	void ClearWorldEvent();
+
 public:
 	// ---------- Equip / unequip / drop ----------
 
@@ -62,8 +132,8 @@ public:
 
 	virtual void OnDropped(const FVector& DropLocation, const FVector& TossVelocity);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_OnDropped(const FVector& DropLocation, const FVector& TossVelocity);
+	/** Server: drop on every relevant machine (via WorldEvent) and here right away. */
+	void NotifyDropped(const FVector& DropLocation, const FVector& TossVelocity);
 
 	// ---------- Placement API ----------
 
@@ -72,17 +142,34 @@ public:
 	bool CanBePlaced() const;
 	virtual bool CanBePlaced_Implementation() const { return false; }
 
-	/** Base placement behavior. Called on all machines via Multicast_OnPlaced. */
+	/** Mesh for the owning client's placement ghost (null = no ghost, placement still works). */
+	virtual UStaticMesh* GetPlacementPreviewMesh() const { return nullptr; }
+
+	/** Base placement behavior. Called on all machines via NotifyPlaced / WorldEvent. */
 	virtual void OnPlaced(const FTransform& WorldTransform);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void Multicast_OnPlaced(const FTransform& WorldTransform);
+	/** Server: place on every relevant machine (via WorldEvent) and here right away. */
+	void NotifyPlaced(const FTransform& WorldTransform);
+
+	// ---------- Pooling (USFW_EquippablePoolSubsystem, server) ----------
+
+	/** Handed out again: wakes replication, shows the actor and restores interaction collision. */
+	virtual void OnAcquiredFromPool();
+
+	/**
+	 * Back in the pool: detach, hide, no physics / collision / owner, then dormant.
+	 * Devices override to switch themselves off and call Super last.
+	 */
+	virtual void OnReturnedToPool();
+
+	bool IsPooled() const { return bPooled; }
 
 	// ---------- Use ----------
 
 	virtual void PrimaryUse() {}
 	virtual void SecondaryUse() {}
 
+	/** May be null (see Mesh). */
 	USkeletalMeshComponent* GetMesh() const { return Mesh; }
 
 	// Interactable interface
@@ -100,6 +187,23 @@ protected:
 	void AttachToCharacter(ACharacter* Char, FName Socket);
 	void DetachFromCharacter();
 
+	/**
+	 * Server: DORM_DormantAll when lying in the world and not moving (placed, or dropped and asleep).
+	 * Device state setters call FlushNetDormancy() before writing; picking up wakes the item.
+	 */
+	void SettleNetDormancy();
+
+	UFUNCTION()
+	void HandlePhysicsSleep(UPrimitiveComponent* SleepingComponent, FName BoneName);
+
+	/** Retain / release ItemData's and the fallback presentation assets to match ownership. */
+	void UpdatePresentationAssets();
+
+	/** Non-null fallback soft refs (PowerOnSFX, PowerOffSFX, UseSFX, IESProfile). */
+	void GetFallbackPresentationAssets(TArray<FSoftObjectPath>& OutPaths) const;
+
+	FSFWCosmeticEventReceiver WorldEventReceiver;
+
 	virtual UPrimitiveComponent* GetPhysicsComponent() const;
 	virtual FName GetAttachSocketName() const;
 
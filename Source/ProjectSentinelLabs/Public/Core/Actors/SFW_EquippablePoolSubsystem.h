@@ -0,0 +1,69 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_EquippablePoolSubsystem.generated.h"
+
+class AActor;
+class APawn;
+class ASFW_EquippableBase;
+
+USTRUCT()
+struct FSFWEquippablePoolBucket
+{
+	GENERATED_BODY()
+
+	/** Idle, hidden, dormant instances ready to hand out. */
+	UPROPERTY()
+	TArray<TObjectPtr<ASFW_EquippableBase>> Free;
+};
+
+/**
+ * Server-side per-class pool of equippables.
+ * - Pre-warmed at round start with one instance per ASFW_WorldPickup of each item class,
+ *   so grabbing gear at the truck never spawns (mesh, MIDs, audio, actor channel).
+ * - Pooled actors stay replicated but hidden and DORM_DormantAll.
+ * - Reset goes through ASFW_EquippableBase::OnReturnedToPool / OnAcquiredFromPool.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_EquippablePoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_EquippablePoolSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Deinitialize() override;
+
+	/** Make sure at least Count idle instances of Class exist. */
+	void Prewarm(TSubclassOf<ASFW_EquippableBase> Class, int32 Count);
+
+	/** Pre-warm the expected loadout: one instance per world pickup of each item class. */
+	void PrewarmFromWorldPickups();
+
+	/** Idle instance of Class moved to Transform (spawns if the bucket is empty). */
+	ASFW_EquippableBase* Acquire(TSubclassOf<ASFW_EquippableBase> Class, const FTransform& Transform, AActor* NewOwner, APawn* NewInstigator);
+
+	/** Reset Item and park it. Caller must already have removed it from any inventory. */
+	void Release(ASFW_EquippableBase* Item);
+
+	/** Round end: strip every player's equipment and return everything handed out. */
+	void ReleaseAll();
+
+	int32 GetNumFree(TSubclassOf<ASFW_EquippableBase> Class) const;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UPROPERTY()
+	TMap<TObjectPtr<UClass>, FSFWEquippablePoolBucket> Buckets;
+
+	/** Handed out by Acquire and not yet released. */
+	TArray<TWeakObjectPtr<ASFW_EquippableBase>> Outstanding;
+
+	bool CanPool() const;
+	ASFW_EquippableBase* SpawnPooled(UClass* Class, const FTransform& Transform);
+};
@@ -5,19 +5,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "PlayerCharacter/Animation/SFW_EquipmentTypes.h"
 #include "SFW_Flashlight.generated.h"
 
-class UStaticMeshComponent;
 class USpotLightComponent;
-class USoundBase;
-class UTextureLightProfile;
-class UPrimitiveComponent;
 
 /** Replicated handheld flashlight. One spotlight on the flashlight actor, toggled on Use. */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_Flashlight : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_Flashlight : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -27,6 +23,7 @@ public:
 	// Equippable overrides
 	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
 	virtual void OnUnequipped() override;
+	virtual void OnPresentationAssetsLoaded() override { ApplyLightState(); }
 	virtual void PrimaryUse() override;
 
 	// Anim type override
@@ -34,29 +31,22 @@ public:
 
 	// Toggle API
 	UFUNCTION(BlueprintCallable, Category = "Flashlight")
-	void ToggleLight();
+	void ToggleLight() { TogglePower(); }
 
 	UFUNCTION(BlueprintCallable, Category = "Flashlight")
-	void SetLightEnabled(bool bEnable);
+	void SetLightEnabled(bool bEnable) { SetPowered(bEnable); }
 
 	// Queries
 	UFUNCTION(BlueprintPure, Category = "Flashlight")
-	bool IsOn() const { return bIsOn; }
+	bool IsOn() const { return IsPowered(); }
 
 	
 
 protected:
 	// Components
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flashlight")
-	TObjectPtr<UStaticMeshComponent> FlashlightMesh;
-
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Flashlight")
 	TObjectPtr<USpotLightComponent> Spot;
 
-	// IES Profile
-	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
-	TObjectPtr<UTextureLightProfile> IESProfile = nullptr;
-
 	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
 	bool bUseIESBrightness = true;
 
@@ -77,37 +67,9 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
 	float OuterCone = 20.f;
 
-	// Replicated state
-	UPROPERTY(ReplicatedUsing = OnRep_IsOn)
-	bool bIsOn = false;
-
-	// SFX
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flashlight|SFX")
-	TObjectPtr<USoundBase> ToggleOnSFX = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Flashlight|SFX")
-	TObjectPtr<USoundBase> ToggleOffSFX = nullptr;
-
-	// RepNotifies
-	UFUNCTION()
-	void OnRep_IsOn();
-
-	// Server authority
-	UFUNCTION(Server, Reliable)
-	void Server_SetLightEnabled(bool bEnable);
-
-	// Cosmetic sync
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayToggleSFX(bool bEnable);
-
-	// Which component should get physics when dropped.
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
-
-	
+	// Device
+	virtual void OnPowerChanged(bool bOn) override { ApplyLightState(); }
 
 private:
 	void ApplyLightState();
-
-public:
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
@@ -5,20 +5,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "SFW_GeigerCounter.generated.h"
 
-class UStaticMeshComponent;
-class UAudioComponent;
-class USoundBase;
-class UPrimitiveComponent;
-
 /**
  * Handheld Geiger counter.
  * PrimaryUse() toggles power on/off for now.
  */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_GeigerCounter : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_GeigerCounter : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -26,8 +21,6 @@ public:
 	ASFW_GeigerCounter();
 
 	// Equippable
-	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
-	virtual void OnUnequipped() override;
 	virtual void PrimaryUse() override;
 
 	// Anim type
@@ -35,45 +28,10 @@ public:
 
 	// Power API
 	UFUNCTION(BlueprintCallable, Category = "Geiger")
-	void SetActive(bool bEnable);
+	void SetActive(bool bEnable) { SetPowered(bEnable); }
 
 	UFUNCTION(BlueprintPure, Category = "Geiger")
-	bool IsActive() const { return bIsActive; }
-
-protected:
-	// Visual / physics body
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Geiger")
-	TObjectPtr<UStaticMeshComponent> GeigerMesh;
-
-	// Optional looping tick / hiss while active
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Geiger|Audio")
-	TObjectPtr<UAudioComponent> LoopAudioComp;
-
-	// One-shot power SFX
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Geiger|Audio")
-	TObjectPtr<USoundBase> PowerOnSFX = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Geiger|Audio")
-	TObjectPtr<USoundBase> PowerOffSFX = nullptr;
-
-	// Physics component when dropped
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
+	bool IsActive() const { return IsPowered(); }
 
-	// Replicated power state
-	UPROPERTY(ReplicatedUsing = OnRep_IsActive, BlueprintReadOnly, Category = "Geiger")
-	bool bIsActive = false;
-
-	UFUNCTION()
-	void OnRep_IsActive();
-
-	// Server authority for power
-	UFUNCTION(Server, Reliable)
-	void Server_SetActive(bool bEnable);
-
-	// Apply visuals/audio for current state
-	void ApplyActiveState();
-
-public:
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	// Later: vary tick rate based on anomaly / radiation level (SetLevel + OnLevelChanged).
 };
-
@@ -4,12 +4,11 @@
 
 #include "CoreMinimal.h"
 #include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Net/SFW_CosmeticEvent.h"
 #include "SFW_HeadLamp.generated.h"
 
 class UStaticMeshComponent;
 class USpotLightComponent;
-class USoundBase;
-class UTextureLightProfile;
 
 UCLASS()
 class PROJECTSENTINELLABS_API ASFW_HeadLamp : public ASFW_EquippableBase
@@ -22,6 +21,8 @@ public:
 	// Equippable overrides
 	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
 	virtual void OnUnequipped() override;
+	virtual void OnReturnedToPool() override;
+	virtual void OnPresentationAssetsLoaded() override { ApplyLightState(); }
 
 	// Interact: special case, goes into headlamp slot (not inventory)
 	virtual void Interact_Implementation(AController* InstigatorController) override;
@@ -56,6 +57,13 @@ protected:
 	UFUNCTION()
 	void OnRep_LampEnabled();
 
+	// Toggle click; Type 1 = on, 2 = off
+	UPROPERTY(ReplicatedUsing = OnRep_ToggleEvent)
+	FSFWCosmeticEvent ToggleEvent;
+
+	UFUNCTION()
+	void OnRep_ToggleEvent();
+
 	// Socket and offsets
 	UPROPERTY(EditDefaultsOnly, Category = "HeadLamp|Attach")
 	FName HeadSocketName = TEXT("head_LampSocket");
@@ -82,17 +90,6 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HeadLamp|Light")
 	float OuterCone = 36.f;
 
-	// SFX
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HeadLamp|Audio")
-	TObjectPtr<USoundBase> ToggleOnSFX = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "HeadLamp|Audio")
-	TObjectPtr<USoundBase> ToggleOffSFX = nullptr;
-
-	// IES profile
-	UPROPERTY(EditDefaultsOnly, Category = "HeadLamp|Photometric")
-	TObjectPtr<UTextureLightProfile> IESProfile = nullptr;
-
 	UPROPERTY(EditDefaultsOnly, Category = "HeadLamp|Photometric")
 	bool bUseIESBrightness = true;
 
@@ -106,8 +103,6 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void Server_SetLampEnabled(bool bEnabled);
 
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayToggleSFX(bool bNewEnabled);
 
 	// ASFW_EquippableBase will use this for AttachToCharacter
 	virtual FName GetAttachSocketName() const override { return HeadSocketName; }
@@ -117,5 +112,8 @@ protected:
 
 	// Rep boilerplate
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	FSFWCosmeticEventReceiver ToggleReceiver;
 };
 
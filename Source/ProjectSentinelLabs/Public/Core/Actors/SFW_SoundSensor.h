@@ -5,21 +5,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "SFW_SoundSensor.generated.h"
 
-class UStaticMeshComponent;
-class UAudioComponent;
-class USoundBase;
-class UPrimitiveComponent;
-
 /**
  * Handheld sound sensor.
  * PrimaryUse() toggles it on/off for now.
  * Later you can add placement / world-listening behavior.
  */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_SoundSensor : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_SoundSensor : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -27,8 +22,6 @@ public:
 	ASFW_SoundSensor();
 
 	// Equippable
-	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
-	virtual void OnUnequipped() override;
 	virtual void PrimaryUse() override;
 
 	// Anim type
@@ -36,45 +29,10 @@ public:
 
 	// Power API
 	UFUNCTION(BlueprintCallable, Category = "SoundSensor")
-	void SetActive(bool bEnable);
+	void SetActive(bool bEnable) { SetPowered(bEnable); }
 
 	UFUNCTION(BlueprintPure, Category = "SoundSensor")
-	bool IsActive() const { return bIsActive; }
-
-protected:
-	// Visual / physics body
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SoundSensor")
-	TObjectPtr<UStaticMeshComponent> SensorMesh;
-
-	// Optional loop / processing hum
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "SoundSensor|Audio")
-	TObjectPtr<UAudioComponent> LoopAudioComp;
-
-	// One-shot power SFX
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SoundSensor|Audio")
-	TObjectPtr<USoundBase> PowerOnSFX = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "SoundSensor|Audio")
-	TObjectPtr<USoundBase> PowerOffSFX = nullptr;
-
-	// Physics component when dropped
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
+	bool IsActive() const { return IsPowered(); }
 
-	// Replicated power state
-	UPROPERTY(ReplicatedUsing = OnRep_IsActive, BlueprintReadOnly, Category = "SoundSensor")
-	bool bIsActive = false;
-
-	UFUNCTION()
-	void OnRep_IsActive();
-
-	// Server authority for power
-	UFUNCTION(Server, Reliable)
-	void Server_SetActive(bool bEnable);
-
-	// Apply visuals/audio for current state
-	void ApplyActiveState();
-
-public:
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	// Later: drive visualization / world listening from OnPowerChanged.
 };
-
@@ -3,12 +3,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "PlayerCharacter/Animation/SFW_EquipmentTypes.h"
 #include "SFW_Thermometer.generated.h"
 
 class UStaticMeshComponent;
-class UPrimitiveComponent;
+class UMaterialInstanceDynamic;
 
 /**
  * Handheld thermometer.
@@ -16,7 +16,7 @@ class UPrimitiveComponent;
  * Server updates CurrentTemperature based on environment/anomaly logic.
  */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_Thermometer : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_Thermometer : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -25,8 +25,6 @@ public:
 
 	// Lifecycle
 	virtual void BeginPlay() override;
-	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
-	virtual void OnUnequipped() override;
 
 	// Use
 	virtual void PrimaryUse() override;
@@ -37,10 +35,10 @@ public:
 
 	// Power
 	UFUNCTION(BlueprintCallable, Category = "Thermometer")
-	void SetActive(bool bEnable);
+	void SetActive(bool bEnable) { SetPowered(bEnable); }
 
 	UFUNCTION(BlueprintPure, Category = "Thermometer")
-	bool IsActive() const { return bIsActive; }
+	bool IsActive() const { return IsPowered(); }
 
 	// Reading
 	UFUNCTION(BlueprintPure, Category = "Thermometer")
@@ -59,30 +57,17 @@ public:
 
 
 protected:
-	// Components
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Thermometer")
-	TObjectPtr<UStaticMeshComponent> ThermoMesh;
-
-	// Physics
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
-
-	
-
 	// State
-	UPROPERTY(ReplicatedUsing = OnRep_IsActive, BlueprintReadOnly, Category = "Thermometer")
-	bool bIsActive = false;
-
 	UPROPERTY(ReplicatedUsing = OnRep_CurrentTemperature, BlueprintReadOnly, Category = "Thermometer")
 	float CurrentTemperature = 20.0f; // default room temp
 
-	UFUNCTION()
-	void OnRep_IsActive();
-
 	UFUNCTION()
 	void OnRep_CurrentTemperature();
 
+	// Device
+	virtual void OnPowerChanged(bool bOn) override;
+
 	// Internal
-	void ApplyActiveState();
 	void ApplyTemperatureVisual();
 
 public:
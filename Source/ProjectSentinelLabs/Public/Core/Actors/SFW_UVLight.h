@@ -3,19 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "PlayerCharacter/Animation/SFW_EquipmentTypes.h"
 #include "SFW_UVLight.generated.h"
 
-class UStaticMeshComponent;
 class USpotLightComponent;
-class USoundBase;
-class UTextureLightProfile;
-class UPrimitiveComponent;
 
 /** Handheld UV light. Same family as Flashlight, different beam. */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_UVLight : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_UVLight : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -25,6 +21,7 @@ public:
 	// Equippable overrides
 	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
 	virtual void OnUnequipped() override;
+	virtual void OnPresentationAssetsLoaded() override { ApplyLightState(); }
 	virtual void PrimaryUse() override;
 
 	// Anim type override
@@ -33,26 +30,20 @@ public:
 
 	// Toggle API
 	UFUNCTION(BlueprintCallable, Category = "UVLight")
-	void ToggleLight();
+	void ToggleLight() { TogglePower(); }
 
 	UFUNCTION(BlueprintCallable, Category = "UVLight")
-	void SetLightEnabled(bool bEnable);
+	void SetLightEnabled(bool bEnable) { SetPowered(bEnable); }
 
 	UFUNCTION(BlueprintPure, Category = "UVLight")
-	bool IsOn() const { return bIsOn; }
+	bool IsOn() const { return IsPowered(); }
 
 protected:
 	// Components
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UVLight")
-	TObjectPtr<UStaticMeshComponent> UVMesh;
-
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "UVLight")
 	TObjectPtr<USpotLightComponent> Spot;
 
 	// Photometric settings
-	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
-	TObjectPtr<UTextureLightProfile> IESProfile = nullptr;
-
 	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
 	bool bUseIESBrightness = true;
 
@@ -71,42 +62,10 @@ protected:
 	UPROPERTY(EditDefaultsOnly, Category = "Light|Photometric")
 	float OuterCone = 18.f;
 
-	// Replicated state
-	UPROPERTY(ReplicatedUsing = OnRep_IsOn)
-	bool bIsOn = false;
-
-	// SFX
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UVLight|SFX")
-	TObjectPtr<USoundBase> ToggleOnSFX = nullptr;
-
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "UVLight|SFX")
-	TObjectPtr<USoundBase> ToggleOffSFX = nullptr;
-
-	// RepNotifies
-	UFUNCTION()
-	void OnRep_IsOn();
-
-	// Server authority
-	UFUNCTION(Server, Reliable)
-	void Server_SetLightEnabled(bool bEnable);
-
-	// Cosmetic sync
-	UFUNCTION(NetMulticast, Unreliable)
-	void Multicast_PlayToggleSFX(bool bEnable);
-
-	// Physics body
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
-
-	// Attach socket (tool grip)
-	//virtual FName GetAttachSocketName() const override
-	//{
-		//return TEXT("hand_R_Tool");
-	//}
+	// Device
+	virtual void OnPowerChanged(bool bOn) override { ApplyLightState(); }
 
 private:
 	void ApplyLightState();
-
-public:
-	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 };
 
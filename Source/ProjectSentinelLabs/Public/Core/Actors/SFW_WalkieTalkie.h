@@ -3,18 +3,15 @@
 #pragma once
 
 #include "CoreMinimal.h"
-#include "Core/Actors/SFW_EquippableBase.h"
+#include "Core/Actors/SFW_DeviceBase.h"
 #include "SFW_WalkieTalkie.generated.h"
 
-class UStaticMeshComponent;
-class UPrimitiveComponent;
-
 /**
  * Handheld radio. Owning this in inventory allows long-range comms.
  * Holding it (PrimaryUse) will later key radio transmit.
  */
 UCLASS()
-class PROJECTSENTINELLABS_API ASFW_WalkieTalkie : public ASFW_EquippableBase
+class PROJECTSENTINELLABS_API ASFW_WalkieTalkie : public ASFW_DeviceBase
 {
 	GENERATED_BODY()
 
@@ -29,18 +26,5 @@ public:
 
 	// Anim type override
 	virtual EHeldItemType GetAnimHeldType_Implementation() const override;
-
-protected:
-	// Visible / physical body
-	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Walkie")
-	TObjectPtr<UStaticMeshComponent> WalkieMesh;
-
-	// Which component should get physics when dropped.
-	virtual UPrimitiveComponent* GetPhysicsComponent() const override;
-
-	// Equip / unequip hooks to manage physics and visibility
-	virtual void OnEquipped(ACharacter* NewOwnerChar) override;
-	virtual void OnUnequipped() override;
 };
 
-
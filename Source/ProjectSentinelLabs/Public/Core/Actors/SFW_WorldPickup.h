@@ -38,6 +38,8 @@ protected:
 	FText ItemDisplayName;
 
 public:
+	TSubclassOf<ASFW_EquippableBase> GetItemClass() const { return ItemClass; }
+
 	// --- Interactable Interface ---
 	virtual FText GetPromptText_Implementation() const override;
 	virtual void Interact_Implementation(AController* InstigatorController) override;
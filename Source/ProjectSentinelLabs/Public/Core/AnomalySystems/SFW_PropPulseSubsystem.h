@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_PropPulseSubsystem.generated.h"
+
+class USceneComponent;
+class USFW_AnomalyPropComponent;
+struct FSFWPropPulse;
+
+/**
+ * Runs every active anomaly prop pulse in one tick.
+ * - Pulses live in parallel arrays (base transform, start/end, frequency, amplitudes).
+ * - One pass computes all phases, one 4-wide sin pass evaluates them, one pass writes
+ *   render transforms (SetComponentToWorld + MarkRenderTransformDirty, flushed at end of frame).
+ * - Only ticks while something is pulsing. Never created on dedicated servers.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_PropPulseSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_PropPulseSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Props.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Start (or restart) Prop's pulse on Visual.
+	 * AngularFreq in rad/s, BobAmplitude in uu, TwistAmplitudeDeg signed degrees.
+	 */
+	void AddPulse(USFW_AnomalyPropComponent* Prop, USceneComponent* Visual, const FSFWPropPulse& Pulse,
+		float AngularFreq, float BobAmplitude, float TwistAmplitudeDeg);
+
+	/** Stop Prop's pulse now and restore its visual. */
+	void RemovePulse(USFW_AnomalyPropComponent* Prop);
+
+	int32 GetNumActivePulses() const { return Props.Num(); }
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	// ---------- Parallel arrays, one entry per active pulse ----------
+	TArray<TWeakObjectPtr<USFW_AnomalyPropComponent>> Props;
+	TArray<TWeakObjectPtr<USceneComponent>> Visuals;
+	TArray<FTransform> BaseTransforms;
+	TArray<float> StartTimes;
+	TArray<float> EndTimes;
+	TArray<float> AngularFreqs;
+	TArray<float> BobAmplitudes;
+	TArray<float> TwistAmplitudes;
+
+	/** Scratch: [0, N) bob phases then [N, 2N) twist phases; sin'd in place. */
+	TArray<float> Scratch;
+
+	float GetServerTime() const;
+
+	/** Swap-remove slot, restoring its visual when bRestore. */
+	void RemoveAt(int32 Slot, bool bRestore);
+};
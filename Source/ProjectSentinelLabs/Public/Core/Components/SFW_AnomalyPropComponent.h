@@ -8,10 +8,35 @@
 #include "Components/ActorComponent.h"
 #include "SFW_AnomalyPropComponent.generated.h"
 
+class USceneComponent;
+
+/** Replicated description of one pulse. Clients rebuild the motion from this. */
+USTRUCT(BlueprintType)
+struct FSFWPropPulse
+{
+	GENERATED_BODY()
+
+	/** Server world time the pulse started (GameState clock). < 0 = never pulsed. */
+	UPROPERTY(BlueprintReadOnly)
+	float StartTime = -1.f;
+
+	UPROPERTY(BlueprintReadOnly)
+	float Duration = 0.f;
+
+	/** Drives per-pulse frequency jitter and twist direction, so neighbours do not move in lockstep. */
+	UPROPERTY(BlueprintReadOnly)
+	int32 Seed = 0;
+};
+
 /**
  * Component for props the anomaly can "manipulate":
- * - Temporarily shakes / bobs the actor (visual pulse)
+ * - Temporarily shakes / bobs the visual mesh (cosmetic pulse)
  * - Marks the actor as an EMF source for the same time window
+ *
+ * Server only replicates the pulse (start, duration, seed). Every non-dedicated
+ * machine evaluates the bob locally on the visual mesh's render transform;
+ * the actor itself never moves, so nothing goes through movement replication.
+ * The per-frame evaluation is batched in USFW_PropPulseSubsystem; this component never ticks.
  */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class PROJECTSENTINELLABS_API USFW_AnomalyPropComponent : public UActorComponent
@@ -25,13 +50,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Anomaly|Prop")
 	void TriggerAnomalyPulse(float PulseDurationSec);
 
+	/** Mesh that gets the cosmetic offset. Defaults to the owner's first mesh component. */
+	UFUNCTION(BlueprintCallable, Category = "Anomaly|Prop")
+	void SetVisualComponent(USceneComponent* InVisual);
+
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 protected:
 	virtual void BeginPlay() override;
-	virtual void TickComponent(
-		float DeltaTime,
-		enum ELevelTick TickType,
-		FActorComponentTickFunction* ThisTickFunction
-	) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	/** Max vertical offset (in cm) while pulsing. */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Anomaly|Prop")
@@ -56,13 +83,22 @@ protected:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Anomaly|Prop")
 	float EMFSourceExtraSeconds = 0.25f;
 
+	UPROPERTY(ReplicatedUsing = OnRep_Pulse)
+	FSFWPropPulse Pulse;
+
+	UFUNCTION()
+	void OnRep_Pulse();
+
 private:
-	bool bPulseActive = false;
-	float PulseStartTime = 0.f;
-	float PulseDuration = 0.f;
+	friend class USFW_PropPulseSubsystem;
+
+	UPROPERTY()
+	TObjectPtr<USceneComponent> VisualComp = nullptr;
 
-	FVector BaseLocation = FVector::ZeroVector;
-	FRotator BaseRotation = FRotator::ZeroRotator;
+	/** Slot in USFW_PropPulseSubsystem while pulsing, INDEX_NONE otherwise. Owned by the subsystem. */
+	int32 PulseSlot = INDEX_NONE;
 
+	float GetServerTime() const;
+	void StartLocalPulse();
 	void StopPulse();
 };
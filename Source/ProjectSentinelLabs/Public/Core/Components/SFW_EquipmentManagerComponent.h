@@ -4,12 +4,94 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Engine/EngineTypes.h"
+#include "WorldCollision.h"
 #include "PlayerCharacter/Animation/SFW_EquipmentTypes.h"   // EHeldItemType, EEquipState
 #include "SFW_EquipmentManagerComponent.generated.h"
 
 class ASFW_EquippableBase;
 class ACharacter;
 class ASFW_EMFDevice;
+class USFW_EquipmentManagerComponent;
+class UStaticMeshComponent;
+class UMaterialInterface;
+
+/** One fixed inventory slot. Slots are created once on the server and only ever change Item. */
+USTRUCT()
+struct FSFWInventorySlot : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 SlotIndex = INDEX_NONE;
+
+	UPROPERTY()
+	TObjectPtr<ASFW_EquippableBase> Item = nullptr;
+};
+
+/**
+ * Inventory as a fast array: a slot change sends only that slot.
+ * Client array order is not guaranteed, so always look up by SlotIndex.
+ */
+USTRUCT()
+struct FSFWInventoryList : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<FSFWInventorySlot> Slots;
+
+	UPROPERTY(NotReplicated)
+	TObjectPtr<USFW_EquipmentManagerComponent> OwnerComponent = nullptr;
+
+	/** Client: refresh carried visuals once per received bunch. */
+	void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters);
+
+	/** Server: create NumSlots empty slots (no-op if already there). */
+	void Init(int32 NumSlots);
+
+	ASFW_EquippableBase* GetItem(int32 SlotIndex) const;
+
+	/** Server: returns false if the slot does not exist. */
+	bool SetItem(int32 SlotIndex, ASFW_EquippableBase* Item);
+
+	/** Slot holding Item, INDEX_NONE if none. */
+	int32 FindSlot(const ASFW_EquippableBase* Item) const;
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FSFWInventorySlot, FSFWInventoryList>(Slots, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FSFWInventoryList> : public TStructOpsTypeTraitsBase2<FSFWInventoryList>
+{
+	enum { WithNetDeltaSerializer = true };
+};
+
+/**
+ * Authoritative hand state. PredictionKey is the last owner equip request the server
+ * has answered (accepted or rejected); the owning client reconciles against it.
+ */
+USTRUCT()
+struct FSFWHandState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TObjectPtr<ASFW_EquippableBase> Item = nullptr;
+
+	UPROPERTY()
+	EHeldItemType HeldItem = EHeldItemType::None;
+
+	UPROPERTY()
+	EEquipState Equip = EEquipState::Idle;
+
+	UPROPERTY()
+	uint8 PredictionKey = 0;
+};
 
 /**
  * Owns the player's carried items, hand item, and headlamp.
@@ -27,16 +109,21 @@ public:
 
 	// ~UActorComponent
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	// ~
 
 public:
 	/** All handheld items (some slots may be null). */
 	UPROPERTY(Replicated)
-	TArray<TObjectPtr<ASFW_EquippableBase>> Inventory;
+	FSFWInventoryList Inventory;
 
-	/** Currently shown/equipped hand item (also lives in Inventory). */
-	UPROPERTY(ReplicatedUsing = OnRep_ActiveHandItem)
+	/**
+	 * Currently shown/equipped hand item (also lives in Inventory).
+	 * Local view of Hand: the owning client may run ahead of it while an equip is predicted.
+	 */
+	UPROPERTY(Transient)
 	TObjectPtr<ASFW_EquippableBase> ActiveHandItem = nullptr;
 
 	/** Dedicated headlamp reference (not in Inventory). */
@@ -44,11 +131,11 @@ public:
 	TObjectPtr<ASFW_EquippableBase> HeadLampRef = nullptr;
 
 	/** What the animator should treat as the current handheld type. */
-	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Equipment|Anim")
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Equipment|Anim")
 	EHeldItemType HeldItem = EHeldItemType::None;
 
 	/** High-level equip state used by the animator. */
-	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Equipment|Anim")
+	UPROPERTY(Transient, BlueprintReadOnly, Category = "Equipment|Anim")
 	EEquipState Equip = EEquipState::Idle;
 
 	// ---- Queries ----
@@ -82,8 +169,13 @@ public:
 	UFUNCTION(Server, Reliable)
 	void Server_AddItemToInventory(ASFW_EquippableBase* Item, bool bAutoEquipIfHandEmpty);
 
+	/** Owning client: equip SlotIndex now (predicted) and ask the server to confirm. */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	void EquipSlot(int32 SlotIndex);
+
+	/** PredictionKey 0 = unpredicted request (server / listen host). */
 	UFUNCTION(Server, Reliable)
-	void Server_EquipSlot(int32 SlotIndex);
+	void Server_EquipSlot(int32 SlotIndex, uint8 PredictionKey);
 
 	UFUNCTION(Server, Reliable)
 	void Server_UnequipActive();
@@ -91,9 +183,19 @@ public:
 	UFUNCTION(Server, Reliable)
 	void Server_DropActive();
 
-	/** New: place the current active item (for REM-POD etc.). */
+	/**
+	 * Owning client: place the current active item (REM-POD etc.) where the preview ghost sits.
+	 * Does nothing while the preview is invalid.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Equipment|Place")
+	void PlaceActive();
+
+	/** Client-proposed surface point (pre height offset) and yaw; the server re-validates with one short probe. */
 	UFUNCTION(Server, Reliable)
-	void Server_PlaceActive();
+	void Server_PlaceActive(FVector_NetQuantize10 SurfacePoint, float Yaw);
+
+	UFUNCTION(BlueprintPure, Category = "Equipment|Place")
+	bool IsPlacementValid() const { return bPlacementValid; }
 
 	// Optional tunables
 	UPROPERTY(EditDefaultsOnly, Category = "Equipment|Place")
@@ -105,10 +207,24 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category = "Equipment|Place")
 	float PlaceHeightOffset = 2.f;       // small lift off the surface
 
+	/** Server slack for client-proposed points along the eye trace: reach, early block and overshoot (uu). */
+	UPROPERTY(EditDefaultsOnly, Category = "Equipment|Place")
+	float PlaceValidateTolerance = 12.f;
+
+	/** Preview ghost materials (override every slot of the item's mesh). */
+	UPROPERTY(EditDefaultsOnly, Category = "Equipment|Place")
+	TObjectPtr<UMaterialInterface> PlaceValidMaterial = nullptr;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Equipment|Place")
+	TObjectPtr<UMaterialInterface> PlaceInvalidMaterial = nullptr;
+
 	/** Assign headlamp actor after pickup. */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	void SetHeadLamp(ASFW_EquippableBase* InHeadLamp);
 
+	/** Server: empty every slot, the hand and the headlamp; removed items are appended to OutItems. */
+	void RemoveAllItems(TArray<ASFW_EquippableBase*>& OutItems);
+
 	/** Toggle headlamp on/off (server). */
 	UFUNCTION(Server, Reliable)
 	void Server_ToggleHeadLamp();
@@ -117,18 +233,69 @@ public:
 	void UseActiveLocal();
 
 protected:
+	/** Replicated hand state; ActiveHandItem / HeldItem / Equip mirror it. */
+	UPROPERTY(ReplicatedUsing = OnRep_Hand)
+	FSFWHandState Hand;
+
 	// RepNotify
 	UFUNCTION()
-	void OnRep_ActiveHandItem();
+	void OnRep_Hand();
 
-	/** Applies visibility/attachment when ActiveHandItem changes. */
+	/**
+	 * Brings carried item visuals in line with ActiveHandItem / Inventory.
+	 * Only items whose state changed are touched: a slot switch stows the old hand item
+	 * and equips the new one; stowed items stay attached and hidden.
+	 */
 	void ApplyActiveVisuals();
 
+	friend struct FSFWInventoryList;
+
 private:
 	bool IsValidSlotIndex(int32 Index) const { return Index >= 0 && Index < kMaxInventorySlots; }
 	bool SetItemInSlot_Internal(int32 Index, ASFW_EquippableBase* Item);
 	bool ClearSlot_Internal(int32 Index);
 
+	/** Server: sets Hand (Item plus derived HeldItem / Equip) and mirrors it locally. */
+	void SetActiveHandItem_Internal(ASFW_EquippableBase* Item);
+
+	/** Copies State into ActiveHandItem / HeldItem / Equip and refreshes visuals if the item changed. */
+	void ApplyHandState(const FSFWHandState& State);
+
+	static FSFWHandState MakeHandState(ASFW_EquippableBase* Item, uint8 PredictionKey);
+
+	// ---------- Placement preview (owning client) ----------
+
+	/** Slope / channel rules shared by the preview and the server. Builds OutXform even when invalid. */
+	bool EvaluatePlacementHit(const FHitResult& Hit, float Yaw, FTransform& OutXform) const;
+
+	/** Tick + ghost on while the local player holds something placeable. */
+	void RefreshPlacementPreview();
+
+	void OnPlacementTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+	void UpdatePlacementGhost(bool bHasHit);
+
+	FTraceDelegate PlacementTraceDelegate;
+	FTraceHandle PlacementTrace;
+
+	/** Last preview result: valid flag, surface point and yaw sent to Server_PlaceActive. */
+	bool bPlacementValid = false;
+	FVector PlacementSurfacePoint = FVector::ZeroVector;
+	float PlacementYaw = 0.f;
+
+	UPROPERTY(Transient)
+	TObjectPtr<UStaticMeshComponent> PlacementGhost = nullptr;
+
+	/** Ghost validity the materials were last set for (-1 = never). */
+	int8 GhostMaterialState = -1;
+
+	/** Visual state last applied on this peer (items stowed or in hand, and the hand item). */
+	TArray<TWeakObjectPtr<ASFW_EquippableBase>, TInlineAllocator<kMaxInventorySlots>> VisualCarried;
+	TWeakObjectPtr<ASFW_EquippableBase> VisualHandItem;
+
+	/** Owning client: last key sent, and the one still waiting for the server (0 = none). */
+	uint8 LastPredictionKey = 0;
+	uint8 PendingPredictionKey = 0;
+
 	/** Cached owner character (used for attachment and traces). */
 	UPROPERTY()
 	TObjectPtr<ACharacter> OwnerChar = nullptr;
@@ -8,6 +8,16 @@
 #include "SFW_GameState.generated.h"
 
 class AActor;
+class APawn;
+class APlayerState;
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnRoomOccupancyChanged);
+
+/** Server: a player's occupancy slot was freed and may be reused. (Slot) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FSFWOnOccupancySlotReleased, int32);
+
+/** Server: a player pawn was possessed; volumes it spawned inside can flag it now. (Pawn) */
+DECLARE_MULTICAST_DELEGATE_OneParam(FSFWOnOccupantPossessed, APawn*);
 
 /** Which anomaly archetype is running this match */
 UENUM(BlueprintType)
@@ -46,6 +56,12 @@ public:
 	UFUNCTION(BlueprintCallable) void BeginRound(float Now, int32 Seed);
 	UFUNCTION(BlueprintCallable) void EndRound(float Now);
 
+	// Server setters (push-model replicated; write through these, not the fields)
+	void SetRoundActive(bool bActive);
+	void SetRoundStart(float Now, int32 Seed);
+	void SetAnomalyAggression(float NewAggression);
+	void SetRoundRooms(AActor* InBaseRoom, AActor* InRiftRoom);
+
 	// ------------------------
 	// Global pacing / anomaly info
 	// ------------------------
@@ -64,6 +80,80 @@ public:
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Rooms")
 	AActor* RiftRoom;
 
+	// ------------------------
+	// Room occupancy
+	// Dense room index + one player bitmask per room.
+	// Bit N is the player whose OccupancySlot == N (see ASFW_PlayerState).
+	// ------------------------
+	static constexpr int32 MaxOccupancySlots = 32;
+
+	/** Dense room index -> RoomId. Filled on the server as ARoomVolumes register. */
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Rooms")
+	TArray<FName> RoomIndexIds;
+
+	/** Player bitmask per room, parallel to RoomIndexIds. */
+	UPROPERTY(ReplicatedUsing = OnRep_RoomOccupancy)
+	TArray<uint32> RoomOccupancy;
+
+	/** Parallel to RoomIndexIds: true if any volume of the room is a (non-hallway) safe room. */
+	UPROPERTY(Replicated)
+	TArray<bool> RoomIsSafe;
+
+	/** Fires on server and clients whenever any room mask changes. */
+	UPROPERTY(BlueprintAssignable, Category = "Rooms")
+	FOnRoomOccupancyChanged OnRoomOccupancyChanged;
+
+	UFUNCTION()
+	void OnRep_RoomOccupancy();
+
+	/** Server: returns the dense index for RoomId, adding it if new. bSafe marks the whole room safe. */
+	int32 RegisterRoom(FName RoomId, bool bSafe = false);
+
+	/** Server: set/clear a player's bit. Ref-counted so nested volumes with the same RoomId stay correct. */
+	void AddRoomOccupant(int32 RoomIndex, int32 Slot);
+	void RemoveRoomOccupant(int32 RoomIndex, int32 Slot);
+
+	/** Server: fired before a released slot can be handed out again; volumes drop what they recorded for it. */
+	FSFWOnOccupancySlotReleased OnOccupancySlotReleased;
+
+	/** Server: raised by player pawns from PossessedBy (spawn overlaps fire before there is a slot). */
+	FSFWOnOccupantPossessed OnOccupantPossessed;
+
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	int32 FindRoomIndex(FName RoomId) const { return RoomIndexIds.IndexOfByKey(RoomId); }
+
+	uint32 GetRoomOccupancyMask(int32 RoomIndex) const
+	{
+		return RoomOccupancy.IsValidIndex(RoomIndex) ? RoomOccupancy[RoomIndex] : 0u;
+	}
+
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	bool IsRoomOccupied(FName RoomId) const { return GetRoomOccupancyMask(FindRoomIndex(RoomId)) != 0u; }
+
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	bool IsPlayerInRoom(const APlayerState* PS, FName RoomId) const;
+
+	/** Player's bit is set in any room flagged in RoomIsSafe. */
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	bool IsPlayerInSafeRoom(const APlayerState* PS) const;
+
+	/** Player's bit is set in RiftRoom's room. */
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	bool IsPlayerInRiftRoom(const APlayerState* PS) const;
+
+	/** First room (by dense index) the player is in, or NAME_None. */
+	UFUNCTION(BlueprintPure, Category = "Rooms")
+	FName GetRoomOfPlayer(const APlayerState* PS) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Rooms")
+	void GetPlayersInRoom(FName RoomId, TArray<APlayerState*>& OutPlayers) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Rooms")
+	void GetOccupiedRoomIds(TArray<FName>& OutRoomIds) const;
+
+	virtual void AddPlayerState(APlayerState* PlayerState) override;
+	virtual void RemovePlayerState(APlayerState* PlayerState) override;
+
 	// ------------------------
 	// Evidence window
 	// Replicates to clients. Devices read this.
@@ -138,4 +228,16 @@ public:
 	// Replication
 	// ------------------------
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
+private:
+	/** Server only: per (room, slot) overlap count, RoomIndex * MaxOccupancySlots + Slot. */
+	TArray<uint8> RoomOccupancyRefs;
+
+	/** Server only: which occupancy slots are handed out. */
+	uint32 UsedOccupancySlots = 0u;
+
+	static int32 GetOccupancySlot(const APlayerState* PS);
+
+	/** Re-derive every ASFW_PlayerState's room flags after the table or RiftRoom changed. */
+	void RefreshPlayerRoomFlags();
 };
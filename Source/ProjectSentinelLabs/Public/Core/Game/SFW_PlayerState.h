@@ -29,6 +29,24 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSanityTierChanged, ESanityTier, N
 
 class USFW_AgentCatalog;
 
+/**
+ * Owner-only sanity on the wire.
+ * Value in 1/100 points (0..10000), RatePerSec in 1/1000 points per second.
+ * The owner extrapolates Value + Rate * t between updates, so the server only
+ * resends when the rate changes or the extrapolation drifts (see SanityNetTolerance).
+ */
+USTRUCT()
+struct FSFWSanityNet
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint16 Value = 10000;
+
+	UPROPERTY()
+	int16 RatePerSec = 0;
+};
+
 UCLASS()
 class PROJECTSENTINELLABS_API ASFW_PlayerState : public APlayerState
 {
@@ -56,7 +74,9 @@ public:
 	int32 CharacterIndex = 0;
 
 	// ---------- Anomaly / sanity ----------
-	UPROPERTY(ReplicatedUsing = OnRep_Sanity, BlueprintReadOnly, Category = "Anomaly")
+	// Authoritative on the server. On the owning client this is the last received
+	// (quantized) value; other clients only get SanityTier.
+	UPROPERTY(BlueprintReadOnly, Category = "Anomaly")
 	float Sanity = 100.f;
 
 	// Live tier (replicated for UI)
@@ -83,7 +103,12 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Anomaly|Sanity")
 	float RecoveryCeilPct = 0.8f;          // passive recovery cap = 80% of max
 
-	UPROPERTY(ReplicatedUsing = OnRep_InRiftRoom, BlueprintReadOnly, Category = "Anomaly")
+	// Resend owner sanity once the owner's extrapolation is off by more than this
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Anomaly|Sanity")
+	float SanityNetTolerance = 0.5f;
+
+	// Derived from ASFW_GameState room occupancy on server and clients (see RefreshRoomFlags); not replicated.
+	UPROPERTY(BlueprintReadOnly, Category = "Anomaly")
 	bool bInRiftRoom = false;
 
 	UPROPERTY(ReplicatedUsing = OnRep_Blackout, BlueprintReadOnly, Category = "Anomaly")
@@ -92,10 +117,14 @@ public:
 	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Anomaly")
 	float BlackoutEndTime = 0.f;
 
-	// Safe room flag to enable passive recovery
-	UPROPERTY(ReplicatedUsing = OnRep_SafeRoom, BlueprintReadOnly, Category = "Anomaly|Sanity")
+	// Safe room flag for UI; derived like bInRiftRoom. Passive recovery reads the occupancy table directly.
+	UPROPERTY(BlueprintReadOnly, Category = "Anomaly|Sanity")
 	bool bInSafeRoom = false;
 
+	// Bit index into ASFW_GameState::RoomOccupancy. Assigned by the server on join.
+	UPROPERTY(Replicated, BlueprintReadOnly, Category = "Rooms")
+	int32 OccupancySlot = INDEX_NONE;
+
 	// ---------- Events ----------
 	UPROPERTY(BlueprintAssignable, Category = "Events") FOnCharacterIDChanged OnSelectedCharacterIDChanged;
 	UPROPERTY(BlueprintAssignable, Category = "Events") FOnVariantIDChanged OnSelectedVariantIDChanged;
@@ -116,6 +145,15 @@ public:
 	UFUNCTION(BlueprintPure, Category = "Lobby") bool GetIsHost() const { return bIsHost; }
 	void ServerSetIsHost(bool bNewIsHost);
 
+	/** Server: catalog the lobby/game mode hands every player. */
+	void SetAgentCatalog(USFW_AgentCatalog* InCatalog);
+
+	/** Server: occupancy bit assigned by ASFW_GameState. */
+	void SetOccupancySlot(int32 InSlot);
+
+	/** Re-derive bInRiftRoom / bInSafeRoom from the GameState occupancy table and fire their events. */
+	void RefreshRoomFlags();
+
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Appearance") void ServerSetCharacterIndex(int32 NewIndex);
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Appearance") void ServerCycleCharacter(int32 Direction);
 	UFUNCTION(Server, Reliable, BlueprintCallable, Category = "Appearance") void ServerSetCharacterByID(FName InCharacterID);
@@ -123,14 +161,18 @@ public:
 	// ---------- Anomaly API (server only) ----------
 	UFUNCTION(BlueprintCallable, Category = "Anomaly") void ApplySanityDelta(float Delta);
 	UFUNCTION(BlueprintCallable, Category = "Anomaly") void SetSanity(float NewValue);
-	UFUNCTION(BlueprintCallable, Category = "Anomaly") void SetInRiftRoom(bool bIn);
 	UFUNCTION(BlueprintCallable, Category = "Anomaly") void StartBlackout(float DurationSeconds);
 	UFUNCTION(BlueprintCallable, Category = "Anomaly") void ClearBlackout();
-	UFUNCTION(BlueprintCallable, Category = "Anomaly") void SetInSafeRoom(bool bIn);
 
 	UFUNCTION(BlueprintPure, Category = "Anomaly") bool IsStandingAliveForExtraction() const { return !bIsBlackedOut; }
 	UFUNCTION(BlueprintPure, Category = "Anomaly") ESanityTier GetSanityTier() const { return SanityTier; }
 
+	/** Smooth HUD value. Owning client extrapolates with the replicated drain rate; server returns Sanity. */
+	UFUNCTION(BlueprintPure, Category = "Anomaly") float GetDisplaySanity() const;
+
+	/** Server: current passive drift in points per second (negative = drain). Sent to the owner for extrapolation. */
+	void SetSanityRate(float PerSec);
+
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -142,11 +184,9 @@ protected:
 	UFUNCTION() void OnRep_IsReady();
 	UFUNCTION() void OnRep_IsHost();
 	UFUNCTION() void OnRep_CharacterIndex();
-	UFUNCTION() void OnRep_Sanity();
+	UFUNCTION() void OnRep_SanityNet();
 	UFUNCTION() void OnRep_SanityTier();
-	UFUNCTION() void OnRep_InRiftRoom();
 	UFUNCTION() void OnRep_Blackout();
-	UFUNCTION() void OnRep_SafeRoom();
 
 	virtual void OnRep_PlayerName() override;
 
@@ -159,8 +199,22 @@ protected:
 	// Sanity tier recompute (server sets + replicates)
 	void RecomputeAndApplySanityTier();
 
-	// Passive drift tick (server)
-	void SanityTick();
+	// Raise OnSanityChanged locally
+	void NotifySanityChanged();
+
+	// Server: refresh SanityNet if the owner's extrapolation would be off
+	void UpdateSanityNet();
+
+	UPROPERTY(ReplicatedUsing = OnRep_SanityNet)
+	FSFWSanityNet SanityNet;
+
+	// Server: authoritative drift rate and when SanityNet was last written.
+	// Owning client: when SanityNet was last received.
+	float SanityRate = 0.f;
+	float SanityNetTime = 0.f;
+
+	// Passive drift runs in USFW_SanitySubsystem (server)
+	friend class USFW_SanitySubsystem;
 
 	UPROPERTY(EditAnywhere, Category = "Sanity")
 	TSubclassOf<AActor> ShadeClass;
@@ -170,7 +224,4 @@ protected:
 
 	UPROPERTY(EditAnywhere, Category = "Sanity")
 	float ShadeDrainMultiplier = 2.5f;
-
-private:
-	FTimerHandle SanityTickHandle;
 };
@@ -0,0 +1,44 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_SanitySubsystem.generated.h"
+
+class ASFW_PlayerState;
+
+/**
+ * Server-side passive sanity drift for every player in one timer.
+ * - Walks GameState->PlayerArray once; pawns come from the PlayerState's cached pawn.
+ * - Shade positions are gathered once per tick per distinct ShadeClass, then tested against each player.
+ * - Drain / safe-room recovery tunables still live on ASFW_PlayerState; tier hysteresis
+ *   stays in ASFW_PlayerState::RecomputeAndApplySanityTier (via ApplySanityDelta).
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_SanitySubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Seconds between drift steps. Rates on the PlayerState are per second. */
+	float TickInterval = 1.0f;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	FTimerHandle TickHandle;
+
+	// Scratch reused every tick
+	TArray<TPair<UClass*, int32>> ShadeClassRanges; // class -> start in ShadePositions
+	TArray<FVector> ShadePositions;
+
+	void SanityTick();
+
+	/** Drift for one player over TickInterval seconds (before blackout/none checks). */
+	float ComputeDelta(const ASFW_PlayerState* PS, bool bInSafeRoom, TConstArrayView<FVector> Shades) const;
+};
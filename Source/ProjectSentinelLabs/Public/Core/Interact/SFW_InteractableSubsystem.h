@@ -0,0 +1,152 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "WorldCollision.h"
+#include "SFW_InteractableSubsystem.generated.h"
+
+class APlayerController;
+
+/** One nearby interactable as seen by a focus query. */
+struct FSFWInteractableCandidate
+{
+	AActor* Actor = nullptr;
+
+	/** Where to aim the confirm trace (collision bounds center). */
+	FVector FocusPoint = FVector::ZeroVector;
+
+	/** Collision bounds radius, so big targets (doors) stay focusable off-center. */
+	float Radius = 0.f;
+};
+
+/**
+ * Registry of every actor implementing ISFW_InteractableInterface (native or Blueprint).
+ * - Actors are picked up at world begin play and on spawn, and dropped on destroy.
+ * - Static interactables (doors, pickups, switches) sit in a hash grid keyed by cell,
+ *   with their focus point cached once.
+ * - Dynamic ones (equippables, anything replicating movement) are few and move, so they
+ *   live in a flat list and are distance-checked at their current position.
+ * - Items attached to a pawn (held) or hidden (stowed / pooled) are skipped by queries.
+ *
+ * Server side it also validates interactions: per-class interface support is cached, and
+ * line of sight is checked with async traces whose result is cached per (player, target)
+ * for a short time, so repeated presses on the same door don't trace again.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_InteractableSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_InteractableSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Safe to call more than once; ignored for actors that are not interactable. */
+	void Register(AActor* Actor);
+	void Unregister(AActor* Actor);
+
+	/** Interactables whose focus point lies within Radius of Center. */
+	void GatherInRange(const FVector& Center, float Radius, TArray<FSFWInteractableCandidate>& OutCandidates) const;
+
+	/** Early-out version of GatherInRange. */
+	bool AnyInRange(const FVector& Center, float Radius) const;
+
+	int32 GetNumRegistered() const { return StaticCell.Num() + Dynamic.Num(); }
+
+	/** Cached ImplementsInterface(USFW_InteractableInterface) per class. */
+	bool SupportsInteract(const UClass* Class) const;
+
+	// ---------- Server validation ----------
+
+	/**
+	 * Server only. Validate PC interacting with Target and run Interact.
+	 * Interface, queryable and range checks are immediate; LOS comes from the cache or an
+	 * async trace, in which case those checks run again when the trace lands (next frame).
+	 */
+	void RequestInteract(APlayerController* PC, AActor* Target, float MaxRange);
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Grid cell edge (uu). Larger than any sensible interact range so queries touch few cells. */
+	float CellSize = 400.f;
+
+	/** How long a LOS result stays valid for the same (player, target). */
+	float ValidationTTL = 0.5f;
+
+	/** Cached LOS is dropped early if the player moved more than this. */
+	float ValidationMoveTolerance = 50.f;
+
+	/** LOS trace may stop this short of the target's center and still pass. */
+	float LOSTolerance = 30.f;
+
+private:
+	struct FStaticEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		FVector FocusPoint = FVector::ZeroVector;
+		float Radius = 0.f;
+	};
+
+	TMap<FIntVector, TArray<FStaticEntry>> Cells;
+
+	/** Static actor -> its cell, for removal. */
+	TMap<TObjectKey<AActor>, FIntVector> StaticCell;
+
+	TArray<TWeakObjectPtr<AActor>> Dynamic;
+
+	FDelegateHandle SpawnedHandle;
+	FDelegateHandle DestroyedHandle;
+
+	mutable TMap<TObjectKey<UClass>, bool> InterfaceSupport;
+
+	using FInteractKey = TTuple<TObjectKey<APlayerController>, TObjectKey<AActor>>;
+
+	struct FValidation
+	{
+		double ExpireTime = 0.0;
+		FVector PawnLocation = FVector::ZeroVector;
+		bool bVisible = false;
+	};
+
+	struct FPendingLOS
+	{
+		TWeakObjectPtr<APlayerController> PC;
+		TWeakObjectPtr<AActor> Target;
+		float MaxRange = 0.f;
+		float TargetDist = 0.f;
+		FTraceHandle Trace;
+	};
+
+	TMap<FInteractKey, FValidation> ValidationCache;
+
+	/** One trace in flight per key; further presses while pending are coalesced into it. */
+	TMap<FInteractKey, FPendingLOS> PendingLOS;
+
+	void OnLOSTraceDone(const FTraceHandle& Handle, FTraceDatum& Data, FInteractKey Key);
+	void PruneValidationCache(double Now);
+
+	/** Pawn exists and is within range of Target. */
+	static bool PassesRangeCheck(const APlayerController* PC, const AActor* Target, float MaxRange);
+
+	/** Interactable, queryable (not held / hidden) and in range; checked before every ExecuteInteract. */
+	bool CanInteractNow(const APlayerController* PC, const AActor* Target, float MaxRange) const;
+
+	static void ExecuteInteract(APlayerController* PC, AActor* Target);
+
+	FIntVector CellFor(const FVector& P) const;
+
+	bool IsInteractable(const AActor* Actor) const;
+	static bool IsDynamic(const AActor* Actor);
+	static bool IsQueryable(const AActor* Actor);
+	static FVector ComputeFocusPoint(const AActor* Actor, float& OutRadius);
+
+	/** Visits every queryable entry within Radius; Visitor returns false to stop. */
+	template <typename VisitorType>
+	void ForEachInRange(const FVector& Center, float Radius, VisitorType&& Visitor) const;
+};
@@ -4,11 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
+#include "WorldCollision.h"
 #include "SFW_InteractionComponent.generated.h"
 
 
 class APlayerController;
-
+class APawn;
+class AController;
+
+/**
+ * Client-side interaction focus + server interact RPC.
+ * - Focus: nearby interactables come from USFW_InteractableSubsystem, are scored in a view cone,
+ *   and the best one is confirmed with an async visibility trace (result applied next frame).
+ * - Ticks only on the locally controlled pawn, and only while something is in range; otherwise
+ *   a low-rate wake timer polls the registry.
+ * - Interacting always goes through Server_TryInteract; validation is done by the registry.
+ */
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class PROJECTSENTINELLABS_API USFW_InteractionComponent : public UActorComponent
 {
@@ -29,6 +40,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	UPROPERTY(EditAnywhere, Category = "Interaction")
@@ -40,26 +52,65 @@ protected:
 	UPROPERTY(EditAnywhere, Category = "Interaction")
 	float DebounceSeconds = 0.15f;     // server spam guard
 
+	/** Half angle of the focus cone; widened per target by its bounds radius. */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Focus", meta = (ClampMin = "1", ClampMax = "60"))
+	float FocusConeHalfAngleDeg = 15.f;
+
+	/** How much nearer targets win over centered ones (0 = only aim matters). */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Focus", meta = (ClampMin = "0"))
+	float DistanceWeight = 0.35f;
+
+	/** Score bonus for the current focus, so two close targets don't flicker. */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Focus", meta = (ClampMin = "0"))
+	float FocusStickiness = 0.05f;
+
+	/** Confirm trace may stop this short of the focus point and still count as visible. */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Focus", meta = (ClampMin = "0"))
+	float OcclusionTolerance = 20.f;
+
+	/** Registry poll rate while asleep (nothing in range). */
+	UPROPERTY(EditAnywhere, Category = "Interaction|Focus", meta = (ClampMin = "0.05"))
+	float WakeCheckInterval = 0.25f;
+
 	UPROPERTY(EditAnywhere, Category = "Interaction|Debug")
 	bool bDrawDebug = false;
 
 private:
 	// client-only focus cache
-	UPROPERTY(Transient)
-	AActor* FocusedActor = nullptr;
+	TWeakObjectPtr<AActor> FocusedActor;
 
 	float TraceAccumulator = 0.f;
 	double LastServerInteractTime = -1.0;
 
-	// ---- server RPC ----
+	// ---- async confirm ----
+	FTraceDelegate ConfirmTraceDelegate;
+	FTraceHandle ConfirmTrace;
+	TWeakObjectPtr<AActor> PendingCandidate;
+	float PendingCandidateDist = 0.f;
+
+	// ---- sleep / wake ----
+	FTimerHandle WakeTimer;
+	bool bFocusEnabled = false;
+
+	// ---- server RPC (the only interact path) ----
 	UFUNCTION(Server, Reliable)
 	void Server_TryInteract(AActor* Target);
 
+	/** Server: debounce, then hand off to the registry's validation. */
+	void HandleServerInteract(AActor* Target);
+
 	// ---- helpers ----
 	APlayerController* GetOwningPC() const;
+	bool IsLocalPawn() const;
 	void UpdateFocus();
 	void SetFocus(AActor* NewFocus);
-	bool FindBestInteractable(AActor*& OutActor) const;
+	void OnConfirmTraceDone(const FTraceHandle& Handle, FTraceDatum& Data);
+
+	/** Start / stop focus work to match local control. */
+	void RefreshFocusEnabled();
+	void Sleep();
+	void WakeCheck();
 
-	bool ValidateServerInteract(AActor* Target, APlayerController* PC) const;
+	UFUNCTION()
+	void HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
 };
\ No newline at end of file
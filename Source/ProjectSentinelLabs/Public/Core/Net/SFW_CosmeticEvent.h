@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "SFW_CosmeticEvent.generated.h"
+
+/**
+ * One-shot cosmetic event carried as a replicated property instead of a multicast RPC.
+ * - The server bumps Counter per event; clients play when they see a new Counter.
+ * - Property replication only reaches relevant connections and arrives in the same bunch
+ *   as the actor's other state, so there is no RPC / property ordering to worry about.
+ * - ServerTime lets late joiners and re-relevant clients tell a fresh event from an old one.
+ * Type and payload meaning are defined by the owning actor.
+ */
+USTRUCT()
+struct PROJECTSENTINELLABS_API FSFWCosmeticEvent
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	uint8 Counter = 0;
+
+	/** Actor-defined; 0 = nothing to replay. */
+	UPROPERTY()
+	uint8 Type = 0;
+
+	/** Server world time the event fired. */
+	UPROPERTY()
+	float ServerTime = 0.f;
+
+	UPROPERTY()
+	FVector_NetQuantize10 Location = FVector::ZeroVector;
+
+	/** Actor-defined extra vector (velocity, rotation in degrees, ...). */
+	UPROPERTY()
+	FVector_NetQuantize10 Payload = FVector::ZeroVector;
+
+	/** Server: record a new event. Caller flushes dormancy before and marks the property dirty after. */
+	void Fire(const UObject* WorldContextObject, uint8 InType, const FVector& InLocation, const FVector& InPayload = FVector::ZeroVector);
+
+	/** Server world time as seen on this machine (GameState clock, world time as fallback). */
+	static float GetServerTime(const UObject* WorldContextObject);
+};
+
+enum class ESFWCosmeticEventReceipt : uint8
+{
+	None,   // nothing new
+	Play,   // new and fresh: play it
+	Stale,  // new to this machine but older than MaxAge (late join / re-relevant): skip one-shots
+};
+
+/**
+ * Local read side of an FSFWCosmeticEvent. Not replicated; one per event property.
+ * Feed it from the OnRep (and on the server right after Fire).
+ */
+struct PROJECTSENTINELLABS_API FSFWCosmeticEventReceiver
+{
+	ESFWCosmeticEventReceipt Receive(const UObject* WorldContextObject, const FSFWCosmeticEvent& Event, float MaxAge = 1.f);
+
+	/** Seconds since Event fired on the server (>= 0). */
+	static float GetAge(const UObject* WorldContextObject, const FSFWCosmeticEvent& Event);
+
+private:
+	uint8 LastCounter = 0;
+	bool bInitialized = false;
+};
@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "SFW_ReplicationGraph.generated.h"
+
+class UNetConnection;
+class UReplicationGraphNode_ActorList;
+class UReplicationGraphNode_AlwaysRelevant_ForConnection;
+class UReplicationGraphNode_DormancyNode;
+class UReplicationGraphNode_PlayerStateFrequencyLimiter;
+class USFW_ReplicationGraphNode_Rooms;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSFWRepGraph, Log, All);
+
+/** How an actor class is routed into the graph. */
+enum class ESFWRepNodeMapping : uint8
+{
+	NotRouted,       // handled elsewhere (PlayerController via connection node, PlayerState via limiter)
+	AlwaysRelevant,  // GameState, decision system, anomaly controller, bAlwaysRelevant actors
+	OwnerOnly,       // other bOnlyRelevantToOwner actors: the owning connection's list only
+	RoomStatic,      // doors, lamps, pickups: bucketed into a room once, dormancy-aware
+	RoomDynamic,     // pawns and anything replicating movement: re-bucketed every frame
+	Equippable,      // owner-only while in an inventory, room-bucketed when in the world
+};
+
+/**
+ * Replication graph that uses ARoomVolumes as spatial cells.
+ * - A connection gathers every volume of its viewer's room, the rooms one door away (USFW_RoomSubsystem graph)
+ *   and actors outside every room. Actor cull distances still apply on top.
+ * - Static room actors sit in a per-room dormancy node while dormant, so idle doors/lamps cost nothing.
+ * - Equippables in someone's inventory only replicate to that owner; the hand item also shows in its room.
+ *
+ * Enabled via ReplicationDriverClassName in DefaultEngine.ini.
+ */
+UCLASS(Transient, Config = Engine)
+class PROJECTSENTINELLABS_API USFW_ReplicationGraph : public UReplicationGraph
+{
+	GENERATED_BODY()
+
+public:
+	USFW_ReplicationGraph();
+
+	virtual void InitGlobalActorClassSettings() override;
+	virtual void InitGlobalGraphNodes() override;
+	virtual void InitConnectionGraphNodes(UNetReplicationGraphConnection* ConnectionManager) override;
+	virtual void RemoveClientConnection(UNetConnection* NetConnection) override;
+	virtual void RouteAddNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo) override;
+	virtual void RouteRemoveNetworkActorToNodes(const FNewReplicatedActorInfo& ActorInfo) override;
+	virtual int32 ServerReplicateActors(float DeltaSeconds) override;
+
+	/** Owner-only list for Connection (bOnlyRelevantToOwner actors, inventory equippables), null if unknown. */
+	UReplicationGraphNode_ActorList* GetOwnerOnlyNode(UNetConnection* Connection) const;
+
+	/**
+	 * Server: Actor's owner or hidden state changed; move it between owner-only lists and its room.
+	 * Called by ASFW_EquippableBase. No-op unless Actor's net driver runs this graph.
+	 */
+	static void NotifyOwnerRoutingChanged(AActor* Actor);
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_ActorList> AlwaysRelevantNode;
+
+	UPROPERTY()
+	TObjectPtr<USFW_ReplicationGraphNode_Rooms> RoomNode;
+
+	UPROPERTY()
+	TObjectPtr<UReplicationGraphNode_PlayerStateFrequencyLimiter> PlayerStateNode;
+
+private:
+	ESFWRepNodeMapping GetMappingPolicy(const UClass* Class) const;
+
+	/** Put Actor in its owning connection's list; equippables also enter or leave the room node. */
+	void UpdateOwnerRouting(AActor* Actor);
+
+	/** Resolved per class on first use. */
+	mutable TMap<TObjectKey<UClass>, ESFWRepNodeMapping> ClassMapping;
+
+	UPROPERTY()
+	TMap<TObjectPtr<UNetConnection>, TObjectPtr<UReplicationGraphNode_ActorList>> OwnerOnlyNodes;
+
+	/** Owner-routed actor -> connection whose owner-only list holds it (null: no owning connection yet). */
+	TMap<FActorRepListType, TWeakObjectPtr<UNetConnection>> OwnerRouting;
+
+	/** Owner-routed actors still without an owning connection; retried each replication frame. */
+	TArray<FActorRepListType> PendingOwnerRouting;
+};
+
+/**
+ * Room cells for USFW_ReplicationGraph. One cell per USFW_RoomSubsystem room plus
+ * one trailing "outside" cell for actors that are in no room.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_ReplicationGraphNode_Rooms : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+	USFW_ReplicationGraphNode_Rooms();
+
+	virtual void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override {}
+	virtual bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override { return false; }
+	virtual void NotifyResetAllNetworkActors() override;
+
+	virtual void PrepareForReplication() override;
+	virtual void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	void AddStaticActor(const FNewReplicatedActorInfo& ActorInfo, FGlobalActorReplicationInfo& GlobalInfo);
+	void RemoveStaticActor(const FNewReplicatedActorInfo& ActorInfo);
+
+	void AddDynamicActor(const FNewReplicatedActorInfo& ActorInfo) { DynamicActors.Add(ActorInfo.Actor); }
+	void RemoveDynamicActor(const FNewReplicatedActorInfo& ActorInfo) { DynamicActors.RemoveFast(ActorInfo.Actor); }
+
+	/** In hand, dropped or placed: bucketed by room each frame. Stowed: owner-only, not in any room. */
+	void SetEquippableInWorld(FActorRepListType Actor, bool bInWorld);
+
+private:
+	struct FRoomCell
+	{
+		FActorRepListRefView StaticAwake;
+		FActorRepListRefView Dynamic;
+		UReplicationGraphNode_DormancyNode* Dormant = nullptr; // owned via AllChildNodes
+	};
+
+	TArray<FRoomCell> Cells;
+
+	/** Room subsystem build the cells were laid out for. */
+	uint32 CellsSerial = 0;
+
+	FActorRepListRefView DynamicActors;
+
+	/** Equippables currently in the world (not stowed in an inventory). */
+	FActorRepListRefView Equippables;
+
+	/** Static actor -> cell index. */
+	TMap<FActorRepListType, int32> StaticCell;
+
+	int32 OutsideCell() const { return Cells.Num() - 1; }
+	int32 CellFor(const AActor* Actor) const;
+
+	void RebuildCells();
+	void InsertStatic(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, int32 Cell);
+	void EvictStatic(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, int32 Cell);
+	void OnStaticDormancyChange(FActorRepListType Actor, FGlobalActorReplicationInfo& GlobalInfo, ENetDormancy NewValue, ENetDormancy OldValue);
+
+	void GatherCell(int32 Cell, const FConnectionGatherActorListParameters& Params);
+};
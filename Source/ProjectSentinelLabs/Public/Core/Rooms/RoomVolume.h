@@ -24,7 +24,8 @@ enum class ERoomType : uint8
 };
 
 /**
- * Logical room volume. Tracks presence, safe rooms, rift flag.
+ * Logical room volume. Feeds player presence into the ASFW_GameState occupancy table;
+ * safe / rift state is derived from that table.
  */
 UCLASS()
 class PROJECTSENTINELLABS_API ARoomVolume : public ATriggerBox
@@ -55,8 +56,13 @@ public:
     UFUNCTION(BlueprintPure, Category = "Room|Type") bool IsSafeKind()     const { return RoomType == ERoomType::Safe; }
     UFUNCTION(BlueprintPure, Category = "Room|Type") bool IsRiftCandidate()const { return RoomType == ERoomType::RiftCandidate; }
 
+    /** Dense index into ASFW_GameState::RoomOccupancy. Resolved lazily on clients. */
+    UFUNCTION(BlueprintPure, Category = "Room")
+    int32 GetRoomIndex() const;
+
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
     UFUNCTION() void HandleBeginOverlap(AActor* OverlappedActor, AActor* OtherActor);
     UFUNCTION() void HandleEndOverlap(AActor* OverlappedActor, AActor* OtherActor);
@@ -77,8 +83,13 @@ private:
     UPROPERTY()
     TSet<TObjectPtr<USFW_AnomalyPropComponent>> AnomalyPropsInRoom;
 
-    /** Per-player safe-room overlap count (supports nested safe volumes). */
-    TMap<TWeakObjectPtr<APlayerState>, int32> SafeOverlapCount;
+    /** Server: pawns this volume has flagged in the occupancy table, and the slot used. */
+    TMap<TWeakObjectPtr<APawn>, int32> OccupantSlots;
+
+    /** Server: overlapping pawns that had no occupancy slot yet (spawned inside, not possessed). */
+    TSet<TWeakObjectPtr<APawn>> PendingOccupants;
+
+    mutable int32 RoomIndex = INDEX_NONE;
 
     bool IsPlayerPawn(AActor* Actor) const;
     APlayerState* GetPlayerStateFromActor(AActor* Actor) const;
@@ -87,11 +98,14 @@ private:
 
     void NotifyPresenceChanged(APlayerState* PS, bool bEnter) const;
 
-    /** Adjust safe-room state for a player by +1 / -1 overlaps. */
-    void UpdateSafeFlag(APawn* Pawn, int32 Delta);
+    /** Server: forget every pawn recorded under Slot (its player left). */
+    void HandleOccupancySlotReleased(int32 Slot);
+
+    /** Server: a pending pawn now has a slot; flag it. */
+    void HandleOccupantPossessed(APawn* Pawn);
 
-    /** Mark this pawn's PlayerState as in the Rift if this volume == RiftRoom in GameState. */
-    void UpdateRiftFlag(APawn* Pawn, bool bEnter);
+    /** Set/clear this pawn's bit in the GameState occupancy table. Not debounced. */
+    void UpdateOccupancy(APawn* Pawn, bool bEnter);
 
     /** Cached pointer to GameState for quick checks */
     ASFW_GameState* GetSFWGameState() const;
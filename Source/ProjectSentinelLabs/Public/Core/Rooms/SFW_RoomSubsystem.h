@@ -0,0 +1,188 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SFW_RoomSubsystem.generated.h"
+
+class ARoomVolume;
+class ASFW_DoorBase;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogSFWRooms, Log, All);
+
+/** Door open/closed flipped in the room graph. (DoorIndex, bOpen) */
+DECLARE_MULTICAST_DELEGATE_TwoParams(FSFWOnRoomDoorChanged, int32, bool);
+
+/** Rebuild() finished; room and door indices from before are stale. */
+DECLARE_MULTICAST_DELEGATE(FSFWOnRoomsRebuilt);
+
+/**
+ * Static room lookup built once at level load.
+ * - Oriented box per ARoomVolume, bucketed into a uniform grid.
+ * - Each cell lists its rooms sorted by Priority (higher first), so the first exact hit wins.
+ * - No physics queries; safe to call per device per tick on server or client.
+ *
+ * Also owns the room adjacency graph (CSR), built from door placements:
+ * - Nodes are room indices (same indexing as GetRooms()).
+ * - Each door that has a different room on either side becomes one edge pair.
+ * - Volumes sharing a RoomId are one logical room: zero hops apart, and neighbour
+ *   queries run from / return every volume of a room.
+ * - Hop distances are precomputed for all pairs of logical rooms ignoring door state.
+ * - Door open/closed lives in a bitset on the edges, kept current by ASFW_DoorBase.
+ */
+UCLASS()
+class PROJECTSENTINELLABS_API USFW_RoomSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	static USFW_RoomSubsystem* Get(const UObject* WorldContextObject);
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	/** Rebuild from all ARoomVolumes in the world (eg, after a sublevel streams in). */
+	UFUNCTION(BlueprintCallable, Category = "SFW|Rooms")
+	void Rebuild();
+
+	/** Room containing Location, or null. Overlaps resolve by Priority, then smallest volume. */
+	UFUNCTION(BlueprintPure, Category = "SFW|Rooms")
+	ARoomVolume* FindRoomAt(const FVector& Location) const;
+
+	UFUNCTION(BlueprintPure, Category = "SFW|Rooms")
+	FName FindRoomIdAt(const FVector& Location) const;
+
+	/** Batched lookup. OutRooms[i] matches Points[i] (null when outside every room). */
+	void FindRoomsAt(TConstArrayView<FVector> Points, TArray<ARoomVolume*>& OutRooms) const;
+
+	UFUNCTION(BlueprintCallable, Category = "SFW|Rooms", meta = (DisplayName = "Find Rooms At"))
+	void K2_FindRoomsAt(const TArray<FVector>& Points, TArray<ARoomVolume*>& OutRooms) const { FindRoomsAt(Points, OutRooms); }
+
+	/** Lookup index of the room containing Location, INDEX_NONE if none. Index into GetRooms(). */
+	int32 FindRoomIndexAt(const FVector& Location) const;
+
+	const TArray<TObjectPtr<ARoomVolume>>& GetRooms() const { return Rooms; }
+
+	/** Bumped on every Rebuild(); cache room indices against this. */
+	uint32 GetBuildSerial() const { return BuildSerial; }
+
+	int32 GetRoomIndex(const ARoomVolume* Room) const { return Rooms.IndexOfByKey(Room); }
+
+	/** First room index whose RoomId matches, INDEX_NONE if none. Any volume of a RoomId gives the same graph answers. */
+	int32 GetRoomIndexById(FName RoomId) const;
+
+	/** Every room index with Room's RoomId, Room included. Empty for an invalid index. */
+	TConstArrayView<int32> GetRoomsSharingId(int32 Room) const;
+
+	// ---------- Room graph ----------
+	static constexpr uint8 UnreachableHops = MAX_uint8;
+
+	int32 GetNumEdges() const { return EdgeTo.Num(); }
+
+	/** Edge range of Room: [GetEdgeBegin(Room), GetEdgeEnd(Room)). */
+	int32 GetEdgeBegin(int32 Room) const { return EdgeStart.IsValidIndex(Room) ? EdgeStart[Room] : 0; }
+	int32 GetEdgeEnd(int32 Room) const { return EdgeStart.IsValidIndex(Room + 1) ? EdgeStart[Room + 1] : 0; }
+
+	int32 GetEdgeTarget(int32 Edge) const { return EdgeTo[Edge]; }
+	int32 GetEdgeDoor(int32 Edge) const { return EdgeDoor[Edge]; }
+	bool IsEdgeOpen(int32 Edge) const { return EdgeOpen[Edge]; }
+
+	/** Rooms one door away from any volume of Room's RoomId; never Room's own volumes. bOpenOnly skips closed doors. */
+	void GetNeighborRooms(int32 Room, bool bOpenOnly, TArray<int32>& OutRooms) const;
+
+	/** Precomputed door hops between rooms, ignoring door state. UnreachableHops if disconnected. */
+	int32 GetHopDistance(int32 FromRoom, int32 ToRoom) const;
+
+	/** Hops using only open doors (BFS over the edge bitset). INDEX_NONE if no open route. */
+	int32 GetOpenHopDistance(int32 FromRoom, int32 ToRoom) const;
+
+	UFUNCTION(BlueprintPure, Category = "SFW|Rooms")
+	int32 GetRoomHopDistance(FName FromRoomId, FName ToRoomId, bool bOpenDoorsOnly = false) const;
+
+	int32 GetDoorIndex(const ASFW_DoorBase* InDoor) const;
+	ASFW_DoorBase* GetDoor(int32 DoorIndex) const { return Doors.IsValidIndex(DoorIndex) ? Doors[DoorIndex].Get() : nullptr; }
+	int32 GetNumDoors() const { return Doors.Num(); }
+
+	/** Called by ASFW_DoorBase whenever its state is applied (server and clients). */
+	void SetDoorOpen(const ASFW_DoorBase* InDoor, bool bOpen);
+
+	FSFWOnRoomDoorChanged OnDoorChanged;
+
+	FSFWOnRoomsRebuilt OnRebuilt;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+	/** Target grid cell edge (uu). Grown automatically if the level is huge. */
+	float CellSize = 500.f;
+
+	/** Upper bound on grid cells. */
+	int32 MaxCells = 1 << 18;
+
+	/** How far either side of a door frame to probe for the connected rooms (uu). */
+	float DoorProbeDistance = 120.f;
+
+	/** Probe height above the door frame origin, so floor-level frames land inside room boxes. */
+	float DoorProbeHeight = 90.f;
+
+private:
+	/** Oriented box in SoA-friendly form: center, unit axes, half extents. */
+	struct FRoomBox
+	{
+		FVector Center = FVector::ZeroVector;
+		FVector AxisX = FVector::ForwardVector;
+		FVector AxisY = FVector::RightVector;
+		FVector AxisZ = FVector::UpVector;
+		FVector Extent = FVector::ZeroVector;
+
+		bool Contains(const FVector& P) const
+		{
+			const FVector D = P - Center;
+			return FMath::Abs(FVector::DotProduct(D, AxisX)) <= Extent.X
+				&& FMath::Abs(FVector::DotProduct(D, AxisY)) <= Extent.Y
+				&& FMath::Abs(FVector::DotProduct(D, AxisZ)) <= Extent.Z;
+		}
+	};
+
+	UPROPERTY()
+	TArray<TObjectPtr<ARoomVolume>> Rooms;
+
+	uint32 BuildSerial = 0;
+
+	TArray<FRoomBox> Boxes;
+
+	// Grid (CSR): rooms of cell C are CellRooms[CellStart[C] .. CellStart[C + 1]).
+	FBox GridBounds = FBox(ForceInit);
+	FIntVector GridDims = FIntVector::ZeroValue;
+	float GridCellSize = 0.f;
+	TArray<int32> CellStart;
+	TArray<int32> CellRooms;
+
+	int32 CellIndexFor(const FVector& P) const;
+
+	// Graph (CSR): edges of room R are [EdgeStart[R], EdgeStart[R + 1]).
+	TArray<int32> EdgeStart;
+	TArray<int32> EdgeTo;
+	TArray<int32> EdgeDoor;
+	TBitArray<> EdgeOpen;
+
+	// Logical rooms (CSR): volumes sharing a RoomId. Volumes of group G are
+	// GroupRooms[GroupStart[G] .. GroupStart[G + 1]).
+	TArray<int32> RoomGroup;
+	TArray<int32> GroupStart;
+	TArray<int32> GroupRooms;
+
+	int32 GetNumGroups() const { return FMath::Max(GroupStart.Num() - 1, 0); }
+
+	/** GroupCount x GroupCount hop matrix, row = from. */
+	TArray<uint8> HopDistance;
+
+	TArray<TWeakObjectPtr<ASFW_DoorBase>> Doors;
+	TMap<TObjectKey<ASFW_DoorBase>, int32> DoorToIndex;
+
+	/** The two directed edges of each door: DoorEdges[2 * D], DoorEdges[2 * D + 1]. */
+	TArray<int32> DoorEdges;
+
+	void BuildGraph();
+};
@@ -118,9 +118,6 @@ protected:
 	UFUNCTION()
 	void UseStarted(const FInputActionValue& Value);
 
-	UFUNCTION(Server, Reliable)
-	void Server_Interact(AActor* Target);
-
 	UFUNCTION()
 	void DropStarted(const FInputActionValue& Value);
 